@@ -40,9 +40,11 @@
 #include "Streamer.h"
 #endif
 #include "Viewer.h"
+#include "../media/Player.h"
 #include <getopt.h>
 #include <iostream>
 #include <limits>
+#include <sstream>
 
 #define WH_PRODUCT_NAME "Wanhive Netcam"
 
@@ -62,6 +64,7 @@ bool ClientManager::menu = false;
 unsigned long long ClientManager::hubId = (unsigned long long) -1;
 char ClientManager::hubType = '\0';
 const char *ClientManager::configPath = nullptr;
+const char *ClientManager::recordingPath = nullptr;
 Hub *ClientManager::hub = nullptr;
 
 ClientManager::ClientManager() noexcept {
@@ -92,6 +95,8 @@ void ClientManager::printHelp(FILE *stream) noexcept {
 	fprintf(stream,
 			"-m --menu               \tDisplay menu of available options.\n");
 	fprintf(stream, "-n --name   <identifier>\tSet hub's identifier.\n");
+	fprintf(stream,
+			"-p --play   <path>      \tPlay the recording (index file).\n");
 	fprintf(stream, "-t --type   <type>      \tSet hub's type.\n");
 
 	fprintf(stream, "\n%s requires an external configuration file.\n"
@@ -111,16 +116,17 @@ int ClientManager::parseOptions(int argc, char *const*argv) noexcept {
 	hubId = (unsigned long long) -1;
 	hubType = '\0';
 	configPath = nullptr;
+	recordingPath = nullptr;
 	hub = nullptr;
 	//-----------------------------------------------------------------
 	programName = strrchr(argv[0], Storage::PATH_SEPARATOR);
 	programName = programName ? (programName + 1) : argv[0];
 	//-----------------------------------------------------------------
-	const char *shortOptions = "c:hmn:t:";
+	const char *shortOptions = "c:hmn:p:t:";
 	const struct option longOptions[] = { { "config", 1, nullptr, 'c' }, {
 			"help", 0, nullptr, 'h' }, { "menu", 0, nullptr, 'm' }, { "name", 1,
-			nullptr, 'n' }, { "type", 1, nullptr, 't' }, { nullptr, 0, nullptr,
-			0 } };
+			nullptr, 'n' }, { "play", 1, nullptr, 'p' }, { "type", 1, nullptr,
+			't' }, { nullptr, 0, nullptr, 0 } };
 	//-----------------------------------------------------------------
 	int nextOption;
 	do {
@@ -139,6 +145,9 @@ int ClientManager::parseOptions(int argc, char *const*argv) noexcept {
 		case 'n':
 			sscanf(optarg, "%llu", &hubId);
 			break;
+		case 'p':
+			recordingPath = optarg;
+			break;
 		case 't':
 			sscanf(optarg, "%c", &hubType);
 			break;
@@ -159,10 +168,10 @@ int ClientManager::parseOptions(int argc, char *const*argv) noexcept {
 }
 
 void ClientManager::processOptions() noexcept {
-	int option = 1; //Default option
+	int option = recordingPath ? 3 : 1; //Default option
 	if (menu) {
 		std::cout << "Select an option\n" << "1. NETCAM APPLICATION\n"
-				<< "2. HELP\n" << "::";
+				<< "2. HELP\n" << "3. PLAYBACK\n" << "::";
 		std::cin >> option;
 		if (CommandLine::inputError()) {
 			return;
@@ -179,6 +188,9 @@ void ClientManager::processOptions() noexcept {
 	case 2:
 		f();
 		break;
+	case 3:
+		executePlayer();
+		break;
 	default:
 		std::cerr << "Invalid option" << std::endl;
 		break;
@@ -221,13 +233,21 @@ void ClientManager::executeHub() noexcept {
 			return;
 #endif
 		} else if (mode == 2) {
-			unsigned long long streamerId;
-			std::cout << "Enter streamer's identifier: ";
-			std::cin >> streamerId;
+			unsigned long long streamers[Viewer::MAX_STREAMS];
+			unsigned int count = 0;
+			std::cout << "Enter streamer identifiers (separated by spaces): ";
+			std::cin >> streamers[count++];
 			if (CommandLine::inputError()) {
 				return;
 			}
-			hub = new Viewer(hubId, streamerId, configPath);
+			//Rest of the line lists the additional streamers
+			std::string line;
+			std::getline(std::cin, line);
+			std::istringstream ids(line);
+			while (count < Viewer::MAX_STREAMS && (ids >> streamers[count])) {
+				++count;
+			}
+			hub = new Viewer(hubId, streamers, count, configPath);
 		} else {
 			std::cerr << "Invalid option" << std::endl;
 			return;
@@ -252,6 +272,29 @@ void ClientManager::executeHub() noexcept {
 	hub = nullptr;
 }
 
+void ClientManager::executePlayer() noexcept {
+	std::string path;
+	if (!recordingPath) {
+		std::cout << "Enter recording's index file: ";
+		std::cin >> path;
+		if (CommandLine::inputError()) {
+			return;
+		}
+		recordingPath = path.c_str();
+	}
+
+	try {
+		Player player;
+		player.open(recordingPath);
+		player.execute();
+	} catch (BaseException &e) {
+		WH_LOG_EXCEPTION(e);
+	} catch (...) {
+		WH_LOG_EXCEPTION_U();
+	}
+	recordingPath = nullptr;
+}
+
 void ClientManager::f() noexcept {
 	printHelp(stderr);
 }
@@ -49,6 +49,7 @@ private:
 	static int parseOptions(int argc, char *const*argv) noexcept;
 	static void processOptions() noexcept;
 	static void executeHub() noexcept;
+	static void executePlayer() noexcept;
 	static void f() noexcept;
 	//-----------------------------------------------------------------
 	static void installSignals();
@@ -59,6 +60,7 @@ private:
 	static char hubType;
 	static unsigned long long hubId;
 	static const char *configPath;
+	static const char *recordingPath;
 	static Hub *hub;
 };
 
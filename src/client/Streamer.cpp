@@ -20,6 +20,8 @@
  */
 
 #include "Streamer.h"
+#include <cmath>
+#include <strings.h>
 
 namespace wanhive {
 
@@ -44,8 +46,40 @@ void Streamer::configure(void *arg) {
 		ctx.jpegQuality = (ctx.jpegQuality > 100) ? 100 : ctx.jpegQuality;
 
 		ctx.gps = getConfiguration().getBoolean("NETCAM", "gps");
+		ctx.gpsInterval = getConfiguration().getNumber("NETCAM",
+				"gpsInterval", 100);
+		ctx.gpsHost = getConfiguration().getString("NETCAM", "gpsHost");
+		ctx.gpsPort = getConfiguration().getString("NETCAM", "gpsPort");
+		ctx.gpsReplay = getConfiguration().getString("NETCAM", "gpsReplay");
+		ctx.gpsReplaySpeed = getConfiguration().getNumber("NETCAM",
+				"gpsReplaySpeed", 1);
+		ctx.trackLog = getConfiguration().getString("NETCAM", "trackLog");
 		ctx.servo = getConfiguration().getBoolean("NETCAM", "servo");
+		ctx.simulator = getConfiguration().getBoolean("NETCAM",
+				"i2cSimulator");
+		ctx.trace = getConfiguration().getBoolean("NETCAM", "i2cTrace");
+		ctx.actuator.timeout = getConfiguration().getNumber("NETCAM",
+				"servoTimeout", 250);
+		ctx.actuator.rate = getConfiguration().getNumber("NETCAM", "servoRate",
+				50);
+		ctx.actuator.deadline = getConfiguration().getNumber("NETCAM",
+				"servoDeadline", 1000);
+		ctx.actuator.pan.speed = getConfiguration().getNumber("NETCAM",
+				"panSpeed", 180);
+		ctx.actuator.pan.acceleration = getConfiguration().getNumber("NETCAM",
+				"panAcceleration", 720);
+		ctx.actuator.tilt.speed = getConfiguration().getNumber("NETCAM",
+				"tiltSpeed", 180);
+		ctx.actuator.tilt.acceleration = getConfiguration().getNumber(
+				"NETCAM", "tiltAcceleration", 720);
 
+		loadGimbals();
+		loadPresets();
+		loadIMU();
+		loadSensors();
+		loadStabilizer();
+		loadMotionDetector();
+		loadTracker();
 		WH_LOG_DEBUG(
 				"Streamer settings:\n""CAMERA=%s, JPEGQUALITY=%u, GPS=%s, SERVO=%s",
 				ctx.cameraName, ctx.jpegQuality, (ctx.gps ? "YES" : "NO"),
@@ -85,6 +119,14 @@ void Streamer::route(Message *message) noexcept {
 		handlePairingRequest(message); //Stream request
 	} else if (cmd == 0 && qlf == 1 && status == WH_AQLF_REQUEST) {
 		handlePositionRequest(message); //Pan/Tilt update request
+	} else if (cmd == 0 && qlf == 2 && status == WH_AQLF_REQUEST) {
+		handleVelocityRequest(message); //Pan/Tilt motion request
+	} else if (cmd == 0 && qlf == 3 && status == WH_AQLF_REQUEST) {
+		handlePresetRequest(message); //Go to a preset
+	} else if (cmd == 0 && qlf == 4 && status == WH_AQLF_REQUEST) {
+		handlePatrolRequest(message); //Start/stop the patrol
+	} else if (cmd == 0 && qlf == 5 && status == WH_AQLF_REQUEST) {
+		handleTrackingRequest(message); //Start/stop the motion tracking
 	}
 }
 
@@ -99,12 +141,21 @@ void Streamer::maintain() noexcept {
 void Streamer::processAlarm(unsigned long long uid,
 		unsigned long long ticks) noexcept {
 	try {
+		//The track is recorded even if nobody is watching
+		updateGeoLocation();
+		//Keep the inertial queue drained
+		updateInertialData(isConnected() && peer.id && peer.frames);
+		//Keep the readings drained
+		sendTelemetry(isConnected() && peer.id && peer.frames);
 		if (isConnected() && peer.id && peer.frames) {
-			sendImage(); //For tighter timing
-			devices.camera->read(ctx.jpegQuality);
-			updateGeoLocation();
-		} else {
-			resetGPS();
+			//The gyroscope has caught up with the previous capture
+			if (encodeImage()) {
+				sendImage();
+			}
+			devices.camera->capture();
+			timespec ts;
+			clock_gettime(CLOCK_REALTIME, &ts);
+			captureTime = ts.tv_sec + (ts.tv_nsec / 1000000000.0);
 		}
 	} catch (...) {
 		WH_LOG_DEBUG("Capture device not ready");
@@ -112,6 +163,88 @@ void Streamer::processAlarm(unsigned long long uid,
 	}
 }
 
+bool Streamer::encodeImage() {
+	auto &frame = devices.camera->getImage();
+	if (frame.empty()) {
+		return false;
+	}
+
+	auto &image =
+			devices.stabilizer ?
+					devices.stabilizer->apply(frame, captureTime) : frame;
+	if (devices.detector && !detectMotion(image)) {
+		return false;
+	}
+
+	devices.camera->encode(image, ctx.jpegQuality);
+	motion.sent = captureTime;
+	return true;
+}
+
+bool Streamer::detectMotion(const cv::Mat &image) {
+	if (tracking.moving) {
+		//The view has moved with the gimbal, stop and let it settle
+		timespec ts;
+		clock_gettime(CLOCK_REALTIME, &ts);
+		tracking.still = ts.tv_sec + (ts.tv_nsec / 1000000000.0)
+				+ TRACKING_SETTLE / 1000.0;
+		tracking.moving = false;
+		updateVelocity(tracking.gimbal, 0, 0);
+	}
+
+	if (captureTime < tracking.still) {
+		//Rebuilt from the frames at rest
+		devices.detector->reset();
+	} else if (devices.detector->detect(image, motion.latest)) {
+		motion.detected = captureTime;
+		followMotion(image);
+	}
+
+	auto active = motion.detected
+			&& (captureTime - motion.detected) * 1000 <= ctx.motion.hold;
+	if (active != motion.active || motion.report) {
+		motion.active = active;
+		motion.report = false;
+		sendMotionEvent();
+	}
+
+	if (active) {
+		return true;
+	} else {
+		//Throttled to the idle rate
+		return ctx.motion.idleRate
+				&& (captureTime - motion.sent) * ctx.motion.idleRate >= 60;
+	}
+}
+
+void Streamer::sendMotionEvent() noexcept {
+	if (!Message::available(1)) {
+		return;
+	}
+
+	/*
+	 * Motion event sent on session 2: state (1: motion, 0: idle), capture
+	 * time, changed area (per mille of the frame), and the bounding box of the
+	 * largest blob (x, y, width, height) in the streamed frame.
+	 */
+	auto &box = motion.latest.box;
+	auto message = Message::create();
+	MessageHeader header;
+	header.setAddress(0, peer.id);
+	header.setControl(Message::HEADER_SIZE, 0, 2);
+	header.setContext(0, 3, WH_AQLF_REQUEST);
+	message->putHeader(header);
+	message->appendData32(motion.active ? 1 : 0);
+	message->appendDouble(captureTime);
+	message->appendData32(motion.latest.area);
+	message->appendData32(box.x);
+	message->appendData32(box.y);
+	message->appendData32(box.width);
+	message->appendData32(box.height);
+	message->setDestination(0); //Route via overlay network
+	sendMessage(message);
+}
+
 void Streamer::sendImage() noexcept {
 	unsigned int bytes = 0;
 	auto data = devices.camera->getFrame(bytes);
@@ -137,6 +270,17 @@ void Streamer::sendImage() noexcept {
 	message->appendData32(bytes);
 	message->appendData32(devices.camera->getWidth());
 	message->appendData32(devices.camera->getHeight());
+	//Geotag (mode = 0 if unknown)
+	GeoLocation tag;
+	if (!track.locate(captureTime, tag)) {
+		memset(&tag, 0, sizeof(tag));
+	}
+	message->appendData32(tag.mode);
+	message->appendDouble(captureTime);
+	message->appendDouble(tag.latitude);
+	message->appendDouble(tag.longitude);
+	message->appendDouble(tag.altitude);
+	message->appendDouble(tag.heading);
 	message->setDestination(0); //Route via overlay network
 	sendMessage(message);
 
@@ -155,15 +299,239 @@ void Streamer::sendImage() noexcept {
 	--peer.frames;
 }
 
+void Streamer::updateInertialData(bool streaming) noexcept {
+	if (!devices.imu) {
+		return;
+	}
+
+	constexpr unsigned int BURST = 256;
+	InertialSample samples[BURST];
+	unsigned int count;
+	auto interval = (double) inertial.decimation / devices.imu->getRate();
+	auto &window = inertial.window;
+	while ((count = devices.imu->read(samples, BURST))) {
+		for (unsigned int i = 0; i < count; ++i) {
+			auto &sample = samples[i];
+			if (devices.stabilizer) {
+				//Radians per second
+				constexpr double SCALE = M_PI / 180
+						/ MPU6050::GYRO_SENSITIVITY;
+				double rates[3] = { sample.data.gyro[0] * SCALE,
+						sample.data.gyro[1] * SCALE,
+						sample.data.gyro[2] * SCALE };
+				devices.stabilizer->rotate(sample.timestamp, rates);
+			}
+
+			if (!window.count) {
+				//A gap in the samples (e.g. FIFO overflow) starts a new batch
+				auto expected = inertial.timestamp + inertial.size * interval;
+				if (inertial.size
+						&& fabs(sample.timestamp - expected) > interval / 2) {
+					sendInertialData(streaming);
+				}
+				window.timestamp = sample.timestamp;
+			}
+
+			for (unsigned int j = 0; j < 3; ++j) {
+				window.sums[j] += sample.data.accel[j];
+				window.sums[3 + j] += sample.data.gyro[j];
+			}
+
+			if (++window.count < inertial.decimation) {
+				continue;
+			}
+
+			//Box filter
+			if (!inertial.size) {
+				inertial.timestamp = window.timestamp;
+			}
+			for (unsigned int j = 0; j < INERTIAL_CHANNELS; ++j) {
+				inertial.batch[inertial.size][j] = window.sums[j]
+						/ (int) window.count;
+			}
+			memset(&window, 0, sizeof(window));
+			if (++inertial.size == MAX_INERTIAL) {
+				sendInertialData(streaming);
+			}
+		}
+	}
+
+	if (inertial.size) {
+		sendInertialData(streaming);
+	}
+}
+
+void Streamer::sendInertialData(bool streaming) noexcept {
+	auto size = inertial.size;
+	inertial.size = 0;
+	if (!streaming || !Message::available(1)) {
+		return;
+	}
+
+	/*
+	 * Inertial data sent on session 2: count, interval (microseconds),
+	 * timestamp of the first sample, accelerometer (g/LSB) and gyroscope
+	 * (degrees/s/LSB) scales, followed by the delta encoded samples.
+	 */
+	constexpr unsigned int METADATA = 2 * sizeof(uint32_t) + 3 * sizeof(double);
+	unsigned char data[Message::PAYLOAD_SIZE - METADATA];
+	auto bytes = DeltaCodec::encode(&inertial.batch[0][0], size,
+			INERTIAL_CHANNELS, data, sizeof(data));
+	if (!bytes) {
+		return;
+	}
+
+	auto interval = (inertial.decimation * 1000000ULL)
+			/ devices.imu->getRate();
+	auto message = Message::create();
+	MessageHeader header;
+	header.setAddress(0, peer.id);
+	header.setControl(Message::HEADER_SIZE, 0, 2);
+	header.setContext(0, 0, WH_AQLF_REQUEST);
+	message->putHeader(header);
+	message->appendData32(size);
+	message->appendData32(interval);
+	message->appendDouble(inertial.timestamp);
+	message->appendDouble(1 / MPU6050::ACCEL_SENSITIVITY);
+	message->appendDouble(1 / MPU6050::GYRO_SENSITIVITY);
+	message->appendBytes(data, bytes);
+	message->setDestination(0); //Route via overlay network
+	sendMessage(message);
+}
+
+void Streamer::sendTelemetry(bool streaming) noexcept {
+	if (!devices.sensors) {
+		return;
+	} else if (streaming && announce) {
+		sendSchemas();
+		announce = false;
+	}
+
+	/*
+	 * Sensor readings sent on session 2, as many as fit in a message: count,
+	 * followed by the readings: sensor << 16 | number of values, timestamp,
+	 * values.
+	 */
+	constexpr unsigned int BURST = 32;
+	SensorReading readings[BURST];
+	unsigned int count;
+	Message *message = nullptr;
+	unsigned int records = 0;
+	while ((count = devices.sensors->read(readings, BURST))) {
+		for (unsigned int i = 0; streaming && i < count; ++i) {
+			auto &reading = readings[i];
+			auto fields = devices.sensors->getSchema(reading.sensor)->fields;
+			auto size = sizeof(uint32_t) + sizeof(double) * (1 + fields);
+			if (message
+					&& message->getPayloadLength() + size
+							> Message::PAYLOAD_SIZE) {
+				message->setData32(0, records);
+				sendMessage(message);
+				message = nullptr;
+			}
+
+			if (!message) {
+				if (!Message::available(1)) {
+					streaming = false; //Drop the rest
+					break;
+				}
+
+				message = Message::create();
+				MessageHeader header;
+				header.setAddress(0, peer.id);
+				header.setControl(Message::HEADER_SIZE, 0, 2);
+				header.setContext(0, 1, WH_AQLF_REQUEST);
+				message->putHeader(header);
+				message->appendData32(0);
+				message->setDestination(0); //Route via overlay network
+				records = 0;
+			}
+
+			message->appendData32((reading.sensor << 16) | fields);
+			message->appendDouble(reading.timestamp);
+			for (unsigned int j = 0; j < fields; ++j) {
+				message->appendDouble(reading.values[j]);
+			}
+			++records;
+		}
+	}
+
+	if (message) {
+		message->setData32(0, records);
+		sendMessage(message);
+	}
+}
+
+void Streamer::sendSchemas() noexcept {
+	/*
+	 * A sensor's schema sent on session 2: sensor, interval (milliseconds),
+	 * number of values, name (16 bytes), followed by the name (16 bytes) and
+	 * the unit (8 bytes) of every value.
+	 */
+	for (unsigned int i = 0; i < devices.sensors->size(); ++i) {
+		if (!Message::available(1)) {
+			return;
+		}
+
+		auto schema = devices.sensors->getSchema(i);
+		char name[16];
+		char unit[8];
+		auto message = Message::create();
+		MessageHeader header;
+		header.setAddress(0, peer.id);
+		header.setControl(Message::HEADER_SIZE, 0, 2);
+		header.setContext(0, 2, WH_AQLF_REQUEST);
+		message->putHeader(header);
+		message->appendData32(i);
+		message->appendData32(schema->interval);
+		message->appendData32(schema->fields);
+		strncpy(name, schema->name, sizeof(name));
+		message->appendBytes((const unsigned char*) name, sizeof(name));
+		for (unsigned int j = 0; j < schema->fields; ++j) {
+			strncpy(name, schema->field[j].name, sizeof(name));
+			strncpy(unit, schema->field[j].unit, sizeof(unit));
+			message->appendBytes((const unsigned char*) name, sizeof(name));
+			message->appendBytes((const unsigned char*) unit, sizeof(unit));
+		}
+		message->setDestination(0); //Route via overlay network
+		sendMessage(message);
+	}
+}
+
+void Streamer::followMotion(const cv::Mat &image) noexcept {
+	auto &latest = motion.latest;
+	if (!tracking.active || latest.area > MotionDetector::GLOBAL_CHANGE) {
+		return;
+	}
+
+	//Offset of the blob's center (fractions of the half frame)
+	auto x = (2.0f * latest.box.x + latest.box.width) / image.cols - 1;
+	auto y = (2.0f * latest.box.y + latest.box.height) / image.rows - 1;
+	float rates[2];
+	tracking.tracker.update(captureTime, x, y, rates);
+	if (!rates[0] && !rates[1]) {
+		return;
+	}
+
+	//The gimbal pans left and tilts up at the positive rates
+	if (updateVelocity(tracking.gimbal, -rates[0], -rates[1])) {
+		tracking.moving = true;
+	} else {
+		tracking.active = false;
+	}
+}
+
 int Streamer::handlePairingRequest(Message *message) noexcept {
 	if (message->getPayloadLength() < sizeof(uint32_t)) {
 		return -1;
 	}
 	peer.id = message->getSource();
 	peer.frames = message->getData32(0);
+	announce = true; //The viewer might have missed the schemas
+	motion.report = true; //Tells an idle stream from a stalled one
 	WH_LOG_DEBUG("Node %llu requested %u jpeg frames", peer.id, peer.frames);
 	//-----------------------------------------------------------------
-	//resetGPS();
+	updateGeoLocation(); //Cheap, picks up the fix even if not streaming
 	//-----------------------------------------------------------------
 	/*
 	 * Send acknowledgement
@@ -206,48 +574,342 @@ int Streamer::handlePositionRequest(Message *message) noexcept {
 
 	auto pan = message->getData32(0);
 	auto tilt = message->getData32(sizeof(uint32_t));
-	updatePanTilt(pan, tilt);
+	auto index = getGimbalIndex(message, 2);
+	cancelTracking(index);
+	updatePanTilt(index, pan, tilt);
 	return 0; //no response sent back
 }
 
-bool Streamer::updateGeoLocation() noexcept {
-	return (ctx.gps && devices.gps && devices.gps->read(location));
+int Streamer::handleVelocityRequest(Message *message) noexcept {
+	if (message->getPayloadLength() < sizeof(uint32_t) * 2) {
+		return -1;
+	}
+
+	//Signed rates in degrees per second
+	int panRate = (int32_t) message->getData32(0);
+	int tiltRate = (int32_t) message->getData32(sizeof(uint32_t));
+	auto gimbal = getGimbalIndex(message, 2);
+	cancelTracking(gimbal);
+	updateVelocity(gimbal, panRate, tiltRate);
+	return 0; //no response sent back
 }
 
-void Streamer::resetGPS() noexcept {
-	if (ctx.gps && devices.gps) {
-		devices.gps->reset();
-		location.mode = 0;
+int Streamer::handlePresetRequest(Message *message) noexcept {
+	if (message->getPayloadLength() < sizeof(uint32_t)) {
+		return -1;
+	}
+
+	auto index = message->getData32(0);
+	if (index >= MAX_PRESETS || !presets[index].valid) {
+		return -1;
+	}
+
+	WH_LOG_DEBUG("PRESET: %s", presets[index].name);
+	auto gimbal = getGimbalIndex(message, 1);
+	cancelTracking(gimbal);
+	updatePanTilt(gimbal, presets[index].pan, presets[index].tilt);
+	return 0; //no response sent back
+}
+
+int Streamer::handlePatrolRequest(Message *message) noexcept {
+	if (message->getPayloadLength() < sizeof(uint32_t)) {
+		return -1;
 	}
+
+	auto gimbal = getGimbalIndex(message, 1);
+	cancelTracking(gimbal);
+	updatePatrol(gimbal, message->getData32(0) != 0);
+	return 0; //no response sent back
+}
+
+int Streamer::handleTrackingRequest(Message *message) noexcept {
+	if (message->getPayloadLength() < sizeof(uint32_t)) {
+		return -1;
+	}
+
+	updateTracking(getGimbalIndex(message, 1), message->getData32(0) != 0);
+	return 0; //no response sent back
 }
 
-bool Streamer::updatePanTilt(unsigned int pan, unsigned int tilt) noexcept {
+bool Streamer::updateGeoLocation() noexcept {
+	if (!ctx.gps || !devices.gps) {
+		return false;
+	}
+
+	//Lock free, the GPS is read by a separate thread
+	GeoLocation fix;
+	auto version = devices.gps->read(fix);
+	if (version == fixes) {
+		return false;
+	} else {
+		fixes = version;
+		location = fix;
+		recordGeoLocation(fix);
+		return true;
+	}
+}
+
+void Streamer::recordGeoLocation(const GeoLocation &fix) noexcept {
+	if (!track.add(fix) || !trackLog.isOpen()) {
+		return;
+	}
+
 	try {
-		WH_LOG_DEBUG("PAN: %u, TILT: %u", pan, tilt);
-		if (!ctx.servo || !devices.gimbal) {
-			return false;
-		} else if (pan > 180 || tilt > 180) {
-			return false;
-		} else {
-			devices.gimbal->setPan(pan);
-			devices.gimbal->setTilt(tilt);
-			return true;
-		}
+		trackLog.append(fix);
 	} catch (BaseException &e) {
 		WH_LOG_EXCEPTION(e);
-		delete devices.gimbal;
-		devices.gimbal = nullptr;
-		ctx.servo = false;
+		WH_LOG_WARNING("GPS track log closed");
+		trackLog.close();
+	}
+}
+
+unsigned int Streamer::getGimbalIndex(Message *message,
+		unsigned int arguments) noexcept {
+	auto offset = sizeof(uint32_t) * arguments;
+	if (message->getPayloadLength() >= offset + sizeof(uint32_t)) {
+		return message->getData32(offset);
+	} else {
+		return 0;
+	}
+}
+
+Actuator* Streamer::getActuator(unsigned int index) noexcept {
+	if (ctx.servo && index < MAX_GIMBALS) {
+		return devices.actuators[index];
+	} else {
+		return nullptr;
+	}
+}
+
+bool Streamer::updatePanTilt(unsigned int index, float pan,
+		float tilt) noexcept {
+	WH_LOG_DEBUG("GIMBAL: %u, PAN: %f, TILT: %f", index, pan, tilt);
+	auto actuator = getActuator(index);
+	if (!actuator) {
 		return false;
-	} catch (...) {
-		WH_LOG_EXCEPTION_U();
-		delete devices.gimbal;
-		devices.gimbal = nullptr;
-		ctx.servo = false;
+	} else if (pan < 0 || pan > 180 || tilt < 0 || tilt > 180) {
+		return false;
+	} else if (actuator->post(pan, tilt)) {
+		return true;
+	} else {
+		disableGimbal(index);
+		return false;
+	}
+}
+
+bool Streamer::updateVelocity(unsigned int index, float panRate,
+		float tiltRate) noexcept {
+	WH_LOG_DEBUG("GIMBAL: %u, PAN RATE: %.1f, TILT RATE: %.1f", index,
+			panRate, tiltRate);
+	auto actuator = getActuator(index);
+	if (!actuator) {
+		return false;
+	} else if (panRate < -MAX_VELOCITY || panRate > MAX_VELOCITY
+			|| tiltRate < -MAX_VELOCITY || tiltRate > MAX_VELOCITY) {
+		return false;
+	} else if (actuator->drive(panRate, tiltRate)) {
+		return true;
+	} else {
+		disableGimbal(index);
+		return false;
+	}
+}
+
+bool Streamer::updatePatrol(unsigned int index, bool start) noexcept {
+	WH_LOG_DEBUG("GIMBAL: %u, PATROL: %s", index, (start ? "START" : "STOP"));
+	auto actuator = getActuator(index);
+	if (!actuator) {
 		return false;
+	} else if (actuator->patrol(start)) {
+		return true;
+	} else {
+		disableGimbal(index);
+		return false;
+	}
+}
+
+bool Streamer::updateTracking(unsigned int index, bool start) noexcept {
+	WH_LOG_DEBUG("GIMBAL: %u, TRACKING: %s", index,
+			(start ? "START" : "STOP"));
+	if (start && (!devices.detector || !getActuator(index))) {
+		WH_LOG_WARNING("Tracking requires the motion detection and a gimbal");
+		return false;
+	}
+
+	if (tracking.active && tracking.gimbal != index) {
+		updateVelocity(tracking.gimbal, 0, 0);
+	}
+	tracking.tracker.reset();
+	tracking.gimbal = index;
+	tracking.still = 0;
+	tracking.active = start;
+	tracking.moving = false;
+	//Stops the gimbal (and the patrol)
+	return updateVelocity(index, 0, 0);
+}
+
+void Streamer::cancelTracking(unsigned int index) noexcept {
+	if (tracking.active && tracking.gimbal == index) {
+		WH_LOG_DEBUG("GIMBAL: %u, TRACKING: STOP", index);
+		tracking.active = false;
+		tracking.moving = false;
+	}
+}
+
+void Streamer::disableGimbal(unsigned int index) noexcept {
+	WH_LOG_ERROR("Gimbal %u failed", index);
+	delete devices.actuators[index];
+	devices.actuators[index] = nullptr;
+}
+
+void Streamer::loadGimbals() noexcept {
+	memset(ctx.gimbals, 0, sizeof(ctx.gimbals));
+	unsigned int count = 0;
+	for (unsigned int i = 0; i < MAX_GIMBALS; ++i) {
+		char option[16];
+		snprintf(option, sizeof(option), "gimbal%u", i);
+		auto value = getConfiguration().getString("NETCAM", option);
+		if (!value) {
+			continue;
+		}
+
+		//<adapter> <address> <pan pin> <roll pin> <tilt pin>
+		auto &gimbal = ctx.gimbals[i];
+		int address = 0;
+		if (sscanf(value, "%u %i %u %u %u", &gimbal.adapter, &address,
+				&gimbal.pins.pan, &gimbal.pins.roll, &gimbal.pins.tilt) == 5
+				&& address > 0 && address < 0x80) {
+			gimbal.address = address;
+			gimbal.valid = true;
+			++count;
+		} else {
+			WH_LOG_WARNING("Invalid gimbal: %s", option);
+			memset(&gimbal, 0, sizeof(gimbal));
+		}
+	}
+
+	//Backward compatible default
+	if (!count) {
+		auto &gimbal = ctx.gimbals[0];
+		gimbal.adapter = Gimbal::ADAPTER;
+		gimbal.address = Gimbal::DEVICE;
+		gimbal.pins = Gimbal::PINS;
+		gimbal.valid = true;
+	}
+}
+
+void Streamer::loadPresets() noexcept {
+	memset(presets, 0, sizeof(presets));
+	for (unsigned int i = 0; i < MAX_PRESETS; ++i) {
+		char option[16];
+		snprintf(option, sizeof(option), "preset%u", i);
+		auto value = getConfiguration().getString("NETCAM", option);
+		if (!value) {
+			continue;
+		}
+
+		//<name> <pan> <tilt>
+		auto &preset = presets[i];
+		if (sscanf(value, "%31s %f %f", preset.name, &preset.pan,
+				&preset.tilt) == 3 && preset.pan >= 0 && preset.pan <= 180
+				&& preset.tilt >= 0 && preset.tilt <= 180) {
+			preset.valid = true;
+			WH_LOG_DEBUG("Preset %u: %s (PAN: %f, TILT: %f)", i, preset.name,
+					preset.pan, preset.tilt);
+		} else {
+			WH_LOG_WARNING("Invalid preset: %s", option);
+			memset(&preset, 0, sizeof(preset));
+		}
+	}
+
+	//<preset>:<dwell time in seconds> ...
+	ctx.actuator.stops = 0;
+	auto tour = getConfiguration().getString("NETCAM", "tour");
+	while (tour && ctx.actuator.stops < Actuator::MAX_STOPS) {
+		unsigned int index = 0;
+		unsigned int dwell = 0;
+		int length = 0;
+		if (sscanf(tour, " %u:%u%n", &index, &dwell, &length) != 2) {
+			break;
+		}
+
+		tour += length;
+		if (index >= MAX_PRESETS || !presets[index].valid) {
+			WH_LOG_WARNING("Invalid tour stop: preset%u", index);
+			continue;
+		}
+
+		auto &stop = ctx.actuator.tour[ctx.actuator.stops++];
+		stop.pan = presets[index].pan;
+		stop.tilt = presets[index].tilt;
+		stop.dwell = Twiddler::max(dwell, 1U) * 1000;
 	}
 }
 
+void Streamer::loadIMU() noexcept {
+	memset(&ctx.imu, 0, sizeof(ctx.imu));
+	auto value = getConfiguration().getString("NETCAM", "imu");
+	if (!value) {
+		return;
+	}
+
+	//<adapter> <address>
+	int address = 0;
+	if (sscanf(value, "%u %i", &ctx.imu.adapter, &address) == 2 && address > 0
+			&& address < 0x80) {
+		ctx.imu.address = address;
+		ctx.imu.rate = getConfiguration().getNumber("NETCAM", "imuRate",
+				MPU6050::MAX_RATE);
+		ctx.imu.streamRate = getConfiguration().getNumber("NETCAM",
+				"imuStreamRate", 50);
+		ctx.imu.valid = true;
+	} else {
+		WH_LOG_WARNING("Invalid inertial sensor: imu");
+	}
+}
+
+void Streamer::loadSensors() noexcept {
+	for (unsigned int i = 0; i < SensorScheduler::MAX_SENSORS; ++i) {
+		char option[16];
+		snprintf(option, sizeof(option), "sensor%u", i);
+		ctx.sensors[i] = getConfiguration().getString("NETCAM", option);
+	}
+}
+
+void Streamer::loadStabilizer() noexcept {
+	auto &eis = ctx.eis;
+	eis.enabled = getConfiguration().getBoolean("NETCAM", "eis");
+	eis.settings.crop = getConfiguration().getNumber("NETCAM", "eisCrop", 90);
+	eis.settings.fov = getConfiguration().getNumber("NETCAM", "eisFov", 70);
+	eis.settings.smoothing = getConfiguration().getNumber("NETCAM",
+			"eisSmoothing", 500);
+}
+
+void Streamer::loadMotionDetector() noexcept {
+	auto &motion = ctx.motion;
+	motion.enabled = getConfiguration().getBoolean("NETCAM", "motion");
+	motion.settings.threshold = getConfiguration().getNumber("NETCAM",
+			"motionThreshold", 20);
+	motion.settings.area = getConfiguration().getNumber("NETCAM",
+			"motionArea", 5);
+	motion.hold = getConfiguration().getNumber("NETCAM", "motionHold", 3000);
+	motion.idleRate = getConfiguration().getNumber("NETCAM", "motionIdleRate",
+			6);
+}
+
+void Streamer::loadTracker() noexcept {
+	auto proportional = getConfiguration().getNumber("NETCAM", "trackGain",
+			60);
+	auto integral = getConfiguration().getNumber("NETCAM", "trackIntegral",
+			10);
+	float speed = getConfiguration().getNumber("NETCAM", "trackSpeed", 60);
+	auto deadband = getConfiguration().getNumber("NETCAM", "trackDeadband",
+			5);
+	tracking.tracker.setGains(proportional, integral);
+	tracking.tracker.setLimits(Twiddler::min(speed, (float) MAX_VELOCITY),
+			deadband / 100.0f);
+}
+
 void Streamer::initDevices() {
 	try {
 		if (ctx.cameraName != nullptr) {
@@ -260,14 +922,88 @@ void Streamer::initDevices() {
 
 		//Enable GPS
 		if (ctx.gps) {
-			devices.gps = new GPS();
-			WH_LOG_DEBUG("GPS installed");
+			if (ctx.gpsReplay) {
+				devices.gps = new GPSReader(
+						new GPSReplay(ctx.gpsReplay, ctx.gpsReplaySpeed),
+						ctx.gpsInterval);
+				WH_LOG_DEBUG("GPS replay installed: %s (%ux)", ctx.gpsReplay,
+						ctx.gpsReplaySpeed);
+			} else {
+				devices.gps = new GPSReader(new GPS(ctx.gpsHost, ctx.gpsPort),
+						ctx.gpsInterval);
+				WH_LOG_DEBUG("GPS installed%s%s", (ctx.gpsHost ? " at " : ""),
+						(ctx.gpsHost ? ctx.gpsHost : ""));
+			}
+			if (ctx.trackLog) {
+				trackLog.open(ctx.trackLog, getUid());
+				WH_LOG_DEBUG("GPS track log: %s", ctx.trackLog);
+			}
+		}
+
+		if (ctx.imu.valid) {
+			//The FIFO reads don't delay the gimbal commands
+			auto bus = attachBus(ctx.imu.adapter);
+			simulate(bus, ctx.imu.address, I2CSimulator::MPU6050);
+			auto sensor = new MPU6050(bus->channel(I2CScheduler::STREAM),
+					ctx.imu.address);
+			try {
+				sensor->setRate(ctx.imu.rate);
+			} catch (...) {
+				delete sensor;
+				throw;
+			}
+			devices.imu = new IMUReader(sensor, IMU_INTERVAL);
+			inertial.decimation = Twiddler::max(
+					sensor->getRate() / Twiddler::max(ctx.imu.streamRate, 1U),
+					1U);
+			WH_LOG_DEBUG("IMU installed (I2C-%u, 0x%x) at %u Hz%s",
+					ctx.imu.adapter, ctx.imu.address, sensor->getRate(),
+					(ctx.simulator ? " (simulated)" : ""));
+		}
+
+		if (ctx.eis.enabled && devices.imu) {
+			devices.stabilizer = new Stabilizer(ctx.eis.settings);
+			WH_LOG_DEBUG("Image stabilization enabled (%u%% crop)",
+					ctx.eis.settings.crop);
+		} else if (ctx.eis.enabled) {
+			WH_LOG_WARNING("Image stabilization requires the inertial sensor");
+		}
+
+		if (ctx.motion.enabled) {
+			devices.detector = new MotionDetector(ctx.motion.settings);
+			WH_LOG_DEBUG("Motion detection enabled (%u frames/minute idle)",
+					ctx.motion.idleRate);
 		}
 
-		if (ctx.servo) {
-			devices.gimbal = new Gimbal();
-			devices.gimbal->reset();
-			WH_LOG_DEBUG("Gimbal installed");
+		for (auto specification : ctx.sensors) {
+			if (!specification) {
+				continue;
+			} else if (!devices.sensors) {
+				devices.sensors = new SensorScheduler();
+			}
+
+			devices.sensors->add(attachSensor(specification));
+			WH_LOG_DEBUG("Sensor installed: %s%s", specification,
+					(ctx.simulator ? " (simulated)" : ""));
+		}
+		if (devices.sensors) {
+			devices.sensors->start();
+		}
+
+		for (unsigned int i = 0; ctx.servo && i < MAX_GIMBALS; ++i) {
+			auto &gimbal = ctx.gimbals[i];
+			if (!gimbal.valid) {
+				continue;
+			}
+
+			//The gimbals on the same controller share the batched writes
+			auto servo = attachBoard(gimbal.adapter, gimbal.address);
+			//The actuator thread centers the gimbal
+			devices.actuators[i] = new Actuator(new Gimbal(servo, gimbal.pins),
+					ctx.actuator);
+			WH_LOG_DEBUG("Gimbal %u installed (I2C-%u, 0x%x)%s", i,
+					gimbal.adapter, gimbal.address,
+					(ctx.simulator ? " (simulated)" : ""));
 		}
 	} catch (BaseException &e) {
 		WH_LOG_EXCEPTION(e);
@@ -278,15 +1014,151 @@ void Streamer::initDevices() {
 	}
 }
 
+I2CScheduler* Streamer::attachBus(unsigned int adapter) {
+	unsigned int i = 0;
+	for (; i < MAX_BUSES && devices.buses[i].bus; ++i) {
+		if (devices.buses[i].adapter == adapter) {
+			return devices.buses[i].bus;
+		}
+	}
+
+	if (i == MAX_BUSES) {
+		throw Exception(EX_RESOURCE);
+	}
+
+	auto &entry = devices.buses[i];
+	if (ctx.simulator) {
+		auto simulator = new I2CSimulator();
+		simulator->setTrace(ctx.trace ? stderr : nullptr);
+		entry.bus = new I2CScheduler(simulator);
+		entry.simulator = simulator;
+	} else {
+		entry.bus = new I2CScheduler(new I2CAdapter(adapter));
+	}
+	entry.adapter = adapter;
+	return entry.bus;
+}
+
+Servo* Streamer::attachBoard(unsigned int adapter, unsigned int address) {
+	unsigned int i = 0;
+	for (; i < MAX_GIMBALS && devices.boards[i].servo; ++i) {
+		auto &board = devices.boards[i];
+		if (board.adapter == adapter && board.address == address) {
+			return board.servo;
+		}
+	}
+
+	if (i == MAX_GIMBALS) {
+		throw Exception(EX_RESOURCE);
+	}
+
+	auto bus = attachBus(adapter);
+	simulate(bus, address, I2CSimulator::PCA9685);
+	auto &board = devices.boards[i];
+	board.servo = new Servo(bus->channel(I2CScheduler::CONTROL), address);
+	board.adapter = adapter;
+	board.address = address;
+	return board.servo;
+}
+
+Sensor* Streamer::attachSensor(const char *specification) {
+	char type[16] = { };
+	unsigned int interval = 0;
+	int length = 0;
+	if (sscanf(specification, "%15s %u%n", type, &interval, &length) != 2) {
+		WH_LOG_ERROR("Invalid sensor: %s", specification);
+		throw Exception(EX_PARAMETER);
+	}
+
+	auto arguments = specification + length;
+	if (!strcasecmp(type, "bme280")) {
+		//<adapter> <address>
+		unsigned int adapter = 0;
+		int address = 0;
+		if (sscanf(arguments, "%u %i", &adapter, &address) == 2 && address > 0
+				&& address < 0x80) {
+			//Lowest priority, yields to the gimbals and the FIFO reads
+			auto bus = attachBus(adapter);
+			simulate(bus, address, I2CSimulator::BME280);
+			auto sensor = new BME280(bus->channel(I2CScheduler::POLL), address);
+			try {
+				sensor->setInterval(interval);
+			} catch (...) {
+				delete sensor;
+				throw;
+			}
+			return sensor;
+		}
+	} else if (!strcasecmp(type, "thermal")) {
+		//<zone>
+		unsigned int zone = 0;
+		if (sscanf(arguments, "%u", &zone) == 1) {
+			return new ThermalSensor(zone, interval);
+		}
+	}
+
+	WH_LOG_ERROR("Invalid sensor: %s", specification);
+	throw Exception(EX_PARAMETER);
+}
+
+void Streamer::simulate(I2CScheduler *bus, unsigned int address,
+		I2CSimulator::Model model) {
+	for (auto &entry : devices.buses) {
+		if (entry.bus == bus && entry.simulator) {
+			entry.simulator->attach(address, model);
+		}
+	}
+}
+
 void Streamer::clear() noexcept {
 	delete devices.camera;
+	delete devices.stabilizer;
+	delete devices.detector;
 	delete devices.gps;
-	delete devices.gimbal;
+	//The sensors and the actuators before the controllers and the buses
+	delete devices.imu;
+	delete devices.sensors;
+	for (auto actuator : devices.actuators) {
+		delete actuator;
+	}
+
+	for (auto &board : devices.boards) {
+		delete board.servo;
+	}
+
+	for (auto &entry : devices.buses) {
+		if (entry.simulator) {
+			I2CSimulator::Statistics stats;
+			entry.simulator->getStatistics(stats);
+			WH_LOG_INFO(
+					"I2C-%u: %llu transfers, %llu messages, %llu bytes, %llu us",
+					entry.adapter, stats.transfers, stats.messages,
+					stats.bytes, stats.time);
+		}
+		delete entry.bus;
+	}
 
 	memset(&devices, 0, sizeof(devices));
 	memset(&peer, 0, sizeof(peer));
 	memset(&location, 0, sizeof(GeoLocation));
+	fixes = 0;
+	track.clear();
+	trackLog.close();
+	captureTime = 0;
+	announce = false;
+	memset(&inertial, 0, sizeof(inertial));
+	motion.latest = MotionDetector::Motion();
+	motion.detected = 0;
+	motion.sent = 0;
+	motion.active = false;
+	motion.report = false;
+	tracking.tracker.reset();
+	tracking.gimbal = 0;
+	tracking.still = 0;
+	tracking.active = false;
+	tracking.moving = false;
 	memset(&ctx, 0, sizeof(ctx));
+	memset(presets, 0, sizeof(presets));
 }
 
 } /* namespace wanhive */
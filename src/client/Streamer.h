@@ -22,9 +22,24 @@
 #ifndef CLIENT_STREAMER_H_
 #define CLIENT_STREAMER_H_
 
+#include "../device/Actuator.h"
+#include "../device/BME280.h"
 #include "../device/Camera.h"
+#include "../device/GeoTrack.h"
 #include "../device/GPS.h"
-#include "../device/Gimbal.h"
+#include "../device/GPSReader.h"
+#include "../device/GPSReplay.h"
+#include "../device/IMUReader.h"
+#include "../device/SensorScheduler.h"
+#include "../device/ThermalSensor.h"
+#include "../device/Tracker.h"
+#include "../device/TrackLog.h"
+#include "../interface/I2CAdapter.h"
+#include "../interface/I2CScheduler.h"
+#include "../interface/I2CSimulator.h"
+#include "../media/MotionDetector.h"
+#include "../media/Stabilizer.h"
+#include "../util/DeltaCodec.h"
 #include <wanhive/wanhive.h>
 
 namespace wanhive {
@@ -40,24 +55,119 @@ private:
 	void maintain() noexcept override;
 	void processAlarm(unsigned long long uid, unsigned long long ticks) noexcept
 			override;
+	/*
+	 * Stabilizes (if enabled) and encodes the frame captured last. Returns
+	 * false if the frame is held back (no motion).
+	 */
+	bool encodeImage();
+	//Returns true if the <image> should be streamed, reports the motion
+	bool detectMotion(const cv::Mat &image);
+	//Streams the motion state
+	void sendMotionEvent() noexcept;
+	//Steers the tracking gimbal toward the largest moving object
+	void followMotion(const cv::Mat &image) noexcept;
 	void sendImage() noexcept;
+	//Downsamples the inertial samples, streams them if requested
+	void updateInertialData(bool streaming) noexcept;
+	//Sends (if <streaming>) and empties the inertial batch
+	void sendInertialData(bool streaming) noexcept;
+	//Multiplexes the sensor readings into batches, streams them if requested
+	void sendTelemetry(bool streaming) noexcept;
+	//Streams the schemas of the sensors
+	void sendSchemas() noexcept;
 	//Handle an incoming pairing request
 	int handlePairingRequest(Message *message) noexcept;
 	//Handle an incoming position (PAN/TILT) request
 	int handlePositionRequest(Message *message) noexcept;
+	//Handle an incoming continuous motion (PAN/TILT velocity) request
+	int handleVelocityRequest(Message *message) noexcept;
+	//Handle an incoming preset request
+	int handlePresetRequest(Message *message) noexcept;
+	//Handle an incoming patrol (start/stop) request
+	int handlePatrolRequest(Message *message) noexcept;
+	//Handle an incoming motion tracking (start/stop) request
+	int handleTrackingRequest(Message *message) noexcept;
+	//Fetches the latest GPS fix, returns true if it is a new one
 	bool updateGeoLocation() noexcept;
-	void resetGPS() noexcept;
-	bool updatePanTilt(unsigned int pan, unsigned int tilt) noexcept;
+	//Records a new GPS fix into the track and the track log
+	void recordGeoLocation(const GeoLocation &fix) noexcept;
+	//Returns the gimbal index which follows the <arguments> (default: 0)
+	unsigned int getGimbalIndex(Message *message,
+			unsigned int arguments) noexcept;
+	//Returns the actuator of the <index>th gimbal (nullptr if none)
+	Actuator* getActuator(unsigned int index) noexcept;
+	bool updatePanTilt(unsigned int index, float pan, float tilt) noexcept;
+	bool updateVelocity(unsigned int index, float panRate,
+			float tiltRate) noexcept;
+	bool updatePatrol(unsigned int index, bool start) noexcept;
+	bool updateTracking(unsigned int index, bool start) noexcept;
+	//Ends the tracking if an operator's command moves the <index>th gimbal
+	void cancelTracking(unsigned int index) noexcept;
+	//Disables the <index>th gimbal after a failure
+	void disableGimbal(unsigned int index) noexcept;
+	//Reads the gimbals' controllers and pin maps from the configuration
+	void loadGimbals() noexcept;
+	//Reads the presets and the patrol tour from the configuration
+	void loadPresets() noexcept;
+	//Reads the inertial sensor's settings from the configuration
+	void loadIMU() noexcept;
+	//Reads the sensors' specifications from the configuration
+	void loadSensors() noexcept;
+	//Reads the image stabilization settings from the configuration
+	void loadStabilizer() noexcept;
+	//Reads the motion detection settings from the configuration
+	void loadMotionDetector() noexcept;
+	//Reads the tracking controller's settings from the configuration
+	void loadTracker() noexcept;
 	void initDevices();
+	//Returns the shared I2C bus of the <adapter>, installs it if required
+	I2CScheduler* attachBus(unsigned int adapter);
+	//Creates the sensor described by the <specification>
+	Sensor* attachSensor(const char *specification);
+	//Attaches a simulated device to the <bus> if the bus is simulated
+	void simulate(I2CScheduler *bus, unsigned int address,
+			I2CSimulator::Model model);
+	//Returns the shared PCA9685 controller, installs it if required
+	Servo* attachBoard(unsigned int adapter, unsigned int address);
 	void clear() noexcept;
+public:
+	//Maximum rate of continuous motion (degrees per second)
+	static constexpr int MAX_VELOCITY = 180;
+	static constexpr unsigned int MAX_PRESETS = 10;
+	static constexpr unsigned int MAX_GIMBALS = 4;
+	static constexpr unsigned int MAX_BUSES = 4;
+	//Time for a tracking gimbal to come to rest (milliseconds)
+	static constexpr unsigned int TRACKING_SETTLE = 150;
+	//FIFO drain interval of the inertial sensor (milliseconds)
+	static constexpr unsigned int IMU_INTERVAL = 20;
+	//Maximum number of downsampled inertial samples in a message
+	static constexpr unsigned int MAX_INERTIAL = 32;
+	//Values per inertial sample (accelerometer and gyroscope axes)
+	static constexpr unsigned int INERTIAL_CHANNELS = 6;
 private:
 	/*
 	 * Devices
 	 */
 	struct {
 		Camera *camera;
-		GPS *gps;
-		Gimbal *gimbal;
+		GPSReader *gps;
+		IMUReader *imu;
+		Stabilizer *stabilizer; //Driven by the inertial sensor's gyroscope
+		MotionDetector *detector; //Gates the frames
+		SensorScheduler *sensors; //Samples the registered sensors
+		Actuator *actuators[MAX_GIMBALS]; //Drive the gimbals
+		//Shared I2C buses
+		struct {
+			unsigned int adapter;
+			I2CScheduler *bus;
+			I2CSimulator *simulator; //Simulated I2C bus (owned by the bus)
+		} buses[MAX_BUSES];
+		//Shared PCA9685 controllers
+		struct {
+			unsigned int adapter;
+			unsigned int address;
+			Servo *servo;
+		} boards[MAX_GIMBALS];
 	} devices;
 
 	struct {
@@ -66,13 +176,95 @@ private:
 	} peer;
 
 	GeoLocation location;
+	unsigned long long fixes; //Version of the latest GPS fix
+	GeoTrack track; //Recent GPS fixes
+	TrackLog trackLog; //Persistent GPS track
+	double captureTime; //Capture time of the current frame (Unix)
+	bool announce; //Stream the sensors' schemas
+
+	//Downsampled inertial data waiting to be streamed
+	struct {
+		unsigned int decimation; //Sensor samples per downsampled sample
+		//Accumulator of the sensor samples
+		struct {
+			int sums[INERTIAL_CHANNELS];
+			double timestamp; //Of the first sample
+			unsigned int count;
+		} window;
+		//Batch of the downsampled samples
+		short batch[MAX_INERTIAL][INERTIAL_CHANNELS];
+		double timestamp; //Of the first sample in the batch
+		unsigned int size;
+	} inertial;
+
+	//Motion in the scene
+	struct {
+		MotionDetector::Motion latest; //Of the last frame
+		double detected; //Capture time of the last motion
+		double sent; //Capture time of the last streamed frame
+		bool active; //Within the hold time of a motion
+		bool report; //Stream the state
+	} motion;
+
+	/*
+	 * Motion tracking: the gimbal is driven for a frame, then stopped, and the
+	 * next offset is measured once the view rests.
+	 */
+	struct {
+		Tracker tracker;
+		unsigned int gimbal; //Tracking gimbal
+		double still; //Frames captured after this are at rest
+		bool active;
+		bool moving; //Driven since the last frame
+	} tracking;
 	struct {
 		const char *cameraName;
 		unsigned jpegQuality;
 		bool gps;
+		unsigned int gpsInterval; //GPS polling interval (milliseconds)
+		const char *gpsHost; //gpsd's host (shared memory if nullptr)
+		const char *gpsPort; //gpsd's port
+		const char *gpsReplay; //Replay this capture instead of the GPS
+		unsigned int gpsReplaySpeed; //Replay speed factor
+		const char *trackLog; //Pathname of the GPS track log
+		struct {
+			unsigned int adapter; //I2C adapter number
+			unsigned int address; //MPU6050 address
+			unsigned int rate; //Sample rate (Hz)
+			unsigned int streamRate; //Downsampled rate (Hz)
+			bool valid;
+		} imu;
+		struct {
+			Stabilizer::Settings settings;
+			bool enabled;
+		} eis; //Electronic image stabilization
+		struct {
+			MotionDetector::Settings settings;
+			unsigned int hold; //Full frame rate after a motion (milliseconds)
+			unsigned int idleRate; //Frames per minute without motion
+			bool enabled;
+		} motion;
+		//Sensor specifications: <type> <interval> <arguments>
+		const char *sensors[SensorScheduler::MAX_SENSORS];
 		bool servo;
+		bool simulator; //Drive simulated gimbals
+		bool trace; //Trace the simulated I2C transfers
+		Actuator::Settings actuator;
+		struct {
+			unsigned int adapter; //I2C adapter number
+			unsigned int address; //PCA9685 address
+			Gimbal::Pins pins;
+			bool valid;
+		} gimbals[MAX_GIMBALS];
 	} ctx;
 
+	struct {
+		char name[32];
+		float pan;
+		float tilt;
+		bool valid;
+	} presets[MAX_PRESETS]; //Named gimbal positions
+
 	FlowControl flow; //Flow control
 };
 
@@ -31,6 +31,7 @@
  */
 
 #include "Viewer.h"
+#include <cmath>
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
@@ -74,15 +75,32 @@ char* unixToIso8601(double fixtime, char isotime[], size_t len) {
 	return isotime;
 }
 
+/**
+ * Returns the monotonic clock reading in milliseconds
+ */
+unsigned long long monotonic() noexcept {
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000;
+}
+
 }  // namespace
 
 namespace wanhive {
 
 Viewer::Viewer(unsigned long long uid, unsigned long long streamerId,
 		const char *path) noexcept :
+		Viewer(uid, &streamerId, 1, path) {
+}
+
+Viewer::Viewer(unsigned long long uid, const unsigned long long *streamers,
+		unsigned int count, const char *path) noexcept :
 		ClientHub(uid, path) {
 	clear();
-	peer.id = streamerId;
+	this->count = Twiddler::min(count, MAX_STREAMS);
+	for (unsigned int i = 0; i < this->count; ++i) {
+		feeds[i].peer.id = streamers[i];
+	}
 	flow.setSource(uid);
 }
 
@@ -93,10 +111,46 @@ Viewer::~Viewer() {
 void Viewer::configure(void *arg) {
 	try {
 		ClientHub::configure(arg);
-		sink.writeVideo = getConfiguration().getBoolean("NETCAM", "writeVideo");
-		sink.fourcc = getConfiguration().getString("NETCAM", "fourcc", "MJPG");
-		WH_LOG_DEBUG("Viewer settings:\n""WRITE_VIDEO=%s, FORMAT=%s",
-				(sink.writeVideo ? "YES" : "NO"), sink.fourcc);
+		ctx.writeVideo = getConfiguration().getBoolean("NETCAM", "writeVideo");
+		unsigned int duration = getConfiguration().getNumber("NETCAM",
+				"segmentDuration", 600);
+		unsigned int size = getConfiguration().getNumber("NETCAM",
+				"segmentSize", 256);
+		for (unsigned int i = 0; i < count; ++i) {
+			feeds[i].sink.recorder.setLimits(duration, size * 1024ULL * 1024);
+		}
+
+		if (count > 1) {
+			ctx.tileSize.width = getConfiguration().getNumber("NETCAM",
+					"tileWidth", 480);
+			ctx.tileSize.height = getConfiguration().getNumber("NETCAM",
+					"tileHeight", 270);
+			snprintf(window.name, sizeof(window.name),
+					"Wanhive Netcam: %u streams", count);
+		} else {
+			//Native resolution by default
+			ctx.tileSize.width = getConfiguration().getNumber("NETCAM",
+					"displayWidth", 0);
+			ctx.tileSize.height = getConfiguration().getNumber("NETCAM",
+					"displayHeight", 0);
+		}
+
+		ctx.servoSpeed = getConfiguration().getNumber("NETCAM", "servoSpeed",
+				30);
+		ctx.keepAlive = getConfiguration().getNumber("NETCAM",
+				"servoKeepAlive", 500);
+		ctx.heartbeat = getConfiguration().getNumber("NETCAM",
+				"heartbeatInterval", 5000);
+
+		auto cores = std::thread::hardware_concurrency();
+		ctx.workers = getConfiguration().getNumber("NETCAM", "decoderThreads",
+				Twiddler::min(count, (cores ? cores : 1)));
+		mosaic.start(count, ctx.tileSize, ctx.workers);
+		WH_LOG_DEBUG(
+				"Viewer settings:\n""STREAMS=%u, TILE=%dx%d, DECODERS=%u\n"
+				"WRITE_VIDEO=%s, SEGMENT_DURATION=%us, SEGMENT_SIZE=%uMB",
+				count, ctx.tileSize.width, ctx.tileSize.height, ctx.workers,
+				(ctx.writeVideo ? "YES" : "NO"), duration, size);
 	} catch (BaseException &e) {
 		WH_LOG_EXCEPTION(e);
 		throw;
@@ -104,6 +158,10 @@ void Viewer::configure(void *arg) {
 }
 
 void Viewer::cleanup() noexcept {
+	mosaic.stop();
+	for (unsigned int i = 0; i < count; ++i) {
+		feeds[i].sink.recorder.close();
+	}
 	clear();
 	ClientHub::cleanup();
 }
@@ -128,19 +186,50 @@ void Viewer::route(Message *message) noexcept {
 			handlePairingResponse(message);
 		}
 		break;
-	case 1:
-		if (message->getSource() != image.source) {
+	case 1: {
+		//Demultiplex by the source
+		auto index = find(message->getSource());
+		if (index == count) {
 			return;
-		} else if (cmd == 0 && qlf == 0 && status == WH_AQLF_REQUEST) {
-			processImage(); //Process the image received in previous cycle
-			resetFrame(message->getData32(0),
+		}
+
+		auto &feed = feeds[index];
+		if (cmd == 0 && qlf == 0 && status == WH_AQLF_REQUEST) {
+			processImage(index); //Process the image received in previous cycle
+			//Older sources don't send the capture time
+			auto timestamp =
+					(message->getPayloadLength()
+							>= 4 * sizeof(uint32_t) + sizeof(double)) ?
+							message->getDouble(4 * sizeof(uint32_t)) : 0;
+			resetFrame(feed, message->getData32(0),
 					message->getData32(sizeof(uint32_t)),
-					message->getData32(2 * sizeof(uint32_t)), sequenceNo);
+					message->getData32(2 * sizeof(uint32_t)), sequenceNo,
+					timestamp);
+			updateLocation(feed, message);
+			refresh();
 		} else if (cmd == 0 && qlf == 1 && status == WH_AQLF_REQUEST
-				&& image.sequence == sequenceNo) {
-			populateFrame(message->getBytes(0), message->getPayloadLength());
+				&& feed.image.sequence == sequenceNo) {
+			populateFrame(feed, message->getBytes(0),
+					message->getPayloadLength());
 		}
 		break;
+	}
+	case 2: {
+		//Telemetry
+		auto index = find(message->getSource());
+		if (index == count || status != WH_AQLF_REQUEST) {
+			return;
+		} else if (cmd == 0 && qlf == 0) {
+			updateAttitude(feeds[index], message);
+		} else if (cmd == 0 && qlf == 1) {
+			updateTelemetry(feeds[index], message);
+		} else if (cmd == 0 && qlf == 2) {
+			updateSchema(feeds[index], message);
+		} else if (cmd == 0 && qlf == 3) {
+			updateMotion(feeds[index], message);
+		}
+		break;
+	}
 	default:
 		break;
 	}
@@ -161,30 +250,59 @@ void Viewer::processAlarm(unsigned long long uid,
 		return;
 	}
 
+	//Key presses and motion renewals don't depend on the frames
+	if (window.visible) {
+		refresh();
+	} else {
+		keepMoving();
+	}
+
 	//-----------------------------------------------------------------
+	//The heartbeat spans one or more ticks of the alarm (allow for jitter)
 	unsigned int expiration = 0;
-	unsigned int interval = 0;
-	getAlarmSettings(expiration, interval);
+	unsigned int tick = 0;
+	getAlarmSettings(expiration, tick);
+	auto now = monotonic();
+	if ((now - ctx.beat) + (tick / 2) < ctx.heartbeat) {
+		return;
+	}
+
+	unsigned int interval = ctx.beat ? (now - ctx.beat) : ctx.heartbeat;
+	ctx.beat = now;
 	if (interval) {
-		WH_LOG_DEBUG("Current frame rate: %f frames/s",
-				((double )image.frames * 1000) / interval);
-		if ((unsigned int) image.frames == 0) {
+		unsigned int frames = 0;
+		bool idle = false;
+		for (unsigned int i = 0; i < count; ++i) {
+			auto &image = feeds[i].image;
+			WH_LOG_DEBUG("Stream %llu frame rate: %f frames/s",
+					feeds[i].peer.id, ((double )image.frames * 1000) / interval);
+			frames += image.frames;
+			image.frames = 0; //Reset for the next cycle
+			//An idle stream sends few frames, if any
+			auto &motion = feeds[i].motion;
+			idle = idle || (motion.reported && !motion.active);
+		}
+
+		if (frames == 0 && !idle) {
 			hideWindow();
 		}
-		image.frames = 0; //Reset for the next cycle
 	}
 
-	unsigned int frames = (((double) image.frameRate) * interval) / 825;
-	sendHeartbeat(peer.id, frames);
+	for (unsigned int i = 0; i < count; ++i) {
+		auto &feed = feeds[i];
+		unsigned int frames = (((double) feed.image.frameRate) * interval)
+				/ 825;
+		sendHeartbeat(feed, frames);
+	}
 }
 
-void Viewer::sendHeartbeat(unsigned long long id, unsigned int frames) noexcept {
+void Viewer::sendHeartbeat(Feed &feed, unsigned int frames) noexcept {
 	Message *message = Message::create();
 	if (message) {
-		peer.sequence = flow.nextSequenceNumber();
+		feed.peer.sequence = flow.nextSequenceNumber();
 		MessageHeader header;
-		header.setAddress(0, id);
-		header.setControl(Message::HEADER_SIZE, peer.sequence, 0);
+		header.setAddress(0, feed.peer.id);
+		header.setControl(Message::HEADER_SIZE, feed.peer.sequence, 0);
 		header.setContext(0, 0, WH_AQLF_REQUEST);
 		message->putHeader(header);
 		message->appendData32(frames); //Request new frames
@@ -193,9 +311,10 @@ void Viewer::sendHeartbeat(unsigned long long id, unsigned int frames) noexcept
 	}
 }
 
-bool Viewer::resetSource(unsigned long long id, unsigned int frameRate,
-		unsigned int sequence) noexcept {
-	if (!(id == peer.id && peer.sequence == sequence)) {
+bool Viewer::resetSource(Feed &feed, unsigned long long id,
+		unsigned int frameRate, unsigned int sequence) noexcept {
+	auto &image = feed.image;
+	if (!(id == feed.peer.id && feed.peer.sequence == sequence)) {
 		return false;
 	} else if (!(image.source == id && image.frameRate == frameRate)) {
 		//Source or frame rate changed
@@ -203,8 +322,12 @@ bool Viewer::resetSource(unsigned long long id, unsigned int frameRate,
 		image.source = id;
 		image.frameRate = frameRate;
 
-		memset(&gimbal, 0, sizeof(gimbal));
-		sink.reset = true;
+		memset(&feed.gimbal, 0, sizeof(feed.gimbal));
+		memset(&feed.attitude, 0, sizeof(feed.attitude));
+		memset(&feed.sensors, 0, sizeof(feed.sensors));
+		memset(&feed.motion, 0, sizeof(feed.motion));
+		feed.sink.reset = true;
+		feed.captions = true;
 		return true;
 	} else {
 		//image.frames = 0;
@@ -212,9 +335,12 @@ bool Viewer::resetSource(unsigned long long id, unsigned int frameRate,
 	}
 }
 
-void Viewer::resetFrame(unsigned int size, unsigned int width,
-		unsigned int height, unsigned int sequenceNumber) noexcept {
+void Viewer::resetFrame(Feed &feed, unsigned int size, unsigned int width,
+		unsigned int height, unsigned int sequenceNumber,
+		double timestamp) noexcept {
+	auto &image = feed.image;
 	++image.frames;
+	image.timestamp = timestamp;
 	if (size > sizeof(image.data) || !sequenceNumber) {
 		image.sequence = 0;
 		image.size = 0;
@@ -228,59 +354,72 @@ void Viewer::resetFrame(unsigned int size, unsigned int width,
 			//Image dimensions changed
 			image.width = width;
 			image.height = height;
-			sink.reset = true;
+			feed.sink.reset = true;
+			feed.captions = true;
 		}
 	}
 }
 
-void Viewer::populateFrame(const unsigned char *data,
+void Viewer::populateFrame(Feed &feed, const unsigned char *data,
 		unsigned int bytes) noexcept {
+	auto &image = feed.image;
 	if (data && (image.bytes + bytes) <= image.size) {
 		memcpy(image.data + image.bytes, data, bytes);
 		image.bytes += bytes;
 	}
 }
 
-void Viewer::processImage() noexcept {
+void Viewer::processImage(unsigned int index) noexcept {
+	auto &feed = feeds[index];
+	auto &image = feed.image;
 	try {
 		if (image.size && (image.size == image.bytes)) {
-			resetSink();
-			std::vector<uchar> jpeg(image.data, image.data + image.bytes);
-			cv::Mat img = cv::imdecode(jpeg, cv::IMREAD_ANYCOLOR);
-
-			if (sink.writer.isOpened()) {
-				sink.writer.write(img);
+			resetSink(feed);
+			recordImage(feed);
+			if (!feed.captions) {
+				//The tile keeps its rendered captions
+				mosaic.post(index, image.data, image.bytes, nullptr, 0);
+				return;
 			}
 
-			char text[256];
-			if (location.show) {
-				unixToIso8601(location.timestamp, text, sizeof(text));
-				cv::putText(img, text, cv::Point2f(10, 100),
-						cv::FONT_HERSHEY_COMPLEX_SMALL, 0.6,
-						cv::Scalar(225, 80, 80));
-				snprintf(text, sizeof(text), "Latitude: %f", location.latitude);
-				cv::putText(img, text, cv::Point2f(10, 120),
-						cv::FONT_HERSHEY_COMPLEX_SMALL, 0.6,
-						cv::Scalar(0, 0, 255));
-				snprintf(text, sizeof(text), "Longitude: %f",
-						location.longitude);
-				cv::putText(img, text, cv::Point2f(10, 140),
-						cv::FONT_HERSHEY_COMPLEX_SMALL, 0.6,
-						cv::Scalar(0, 0, 255));
+			char text[Mosaic::MAX_LINES][Overlay::MAX_TEXT];
+			unsigned int lines = 0;
+			if (window.showLocation) {
+				unixToIso8601(feed.location.timestamp, text[lines++],
+						sizeof(text[0]));
+				snprintf(text[lines++], sizeof(text[0]), "Latitude: %f",
+						feed.location.latitude);
+				snprintf(text[lines++], sizeof(text[0]), "Longitude: %f",
+						feed.location.longitude);
+				if (feed.attitude.valid) {
+					snprintf(text[lines++], sizeof(text[0]),
+							"Roll: %.1f Pitch: %.1f", feed.attitude.roll,
+							feed.attitude.pitch);
+				}
 			} else {
-				snprintf(text, sizeof(text), "%llu @ %ufps", image.source,
-						image.frameRate);
-				cv::putText(img, text, cv::Point2f(10, 100),
-						cv::FONT_HERSHEY_COMPLEX_SMALL, 0.6,
-						cv::Scalar(225, 80, 80));
-				snprintf(text, sizeof(text), "[%d x %d]", img.cols, img.rows);
-				cv::putText(img, text, cv::Point2f(10, 120),
-						cv::FONT_HERSHEY_COMPLEX_SMALL, 0.6,
-						cv::Scalar(0, 0, 255));
+				snprintf(text[lines++], sizeof(text[0]), "%llu @ %ufps",
+						image.source, image.frameRate);
+				auto &motion = feed.motion;
+				snprintf(text[lines++], sizeof(text[0]), "[%u x %u]%s",
+						image.width, image.height,
+						(motion.reported ?
+								(motion.active ? " Motion" : " Idle") : ""));
+				snprintf(text[lines++], sizeof(text[0]), "Gimbal: %u%s",
+						feed.gimbal.index,
+						(feed.gimbal.tracking ? " (tracking)" : ""));
+				formatTelemetry(feed, text[lines], sizeof(text[0]));
+				if (text[lines][0]) {
+					++lines;
+				}
 			}
-			cv::imshow(sink.name, img);
-			auto keyCode = cv::waitKey(10) & 0xFF;
-			processKeyPress(keyCode);
+
+			const char *captions[Mosaic::MAX_LINES];
+			for (unsigned int i = 0; i < lines; ++i) {
+				captions[i] = text[i];
+			}
+			//Decoded asynchronously
+			mosaic.post(index, image.data, image.bytes, captions, lines);
+			feed.captions = false;
 		}
 	} catch (BaseException &e) {
 		WH_LOG_EXCEPTION(e);
@@ -291,40 +430,236 @@ void Viewer::processImage() noexcept {
 	}
 }
 
+void Viewer::refresh() noexcept {
+	try {
+		keepMoving();
+		auto now = monotonic();
+		if ((now - window.shown) < DISPLAY_INTERVAL) {
+			return;
+		}
+
+		window.shown = now;
+		if (mosaic.show(window.name)) {
+			window.visible = true;
+		}
+
+		if (window.visible) {
+			auto keyCode = cv::waitKey(1) & 0xFF;
+			processKeyPress(keyCode);
+		}
+	} catch (BaseException &e) {
+		WH_LOG_EXCEPTION(e);
+		WH_LOG_DEBUG("Failed to display the image");
+	} catch (...) {
+		WH_LOG_EXCEPTION_U();
+		WH_LOG_DEBUG("Failed to display the image");
+	}
+}
+
 int Viewer::handlePairingResponse(Message *message) noexcept {
+	unsigned int index = 0;
+	for (; index < count; ++index) {
+		if (feeds[index].peer.id == message->getSource()) {
+			break;
+		}
+	}
+
+	if (index == count) {
+		return -1;
+	}
+
+	auto &feed = feeds[index];
 	if (message->getPayloadLength() >= sizeof(uint32_t)
-			&& resetSource(message->getSource(), message->getData32(0),
+			&& resetSource(feed, message->getSource(), message->getData32(0),
 					message->getSequenceNumber())) {
-		WH_LOG_DEBUG("Source %llu streaming at %u frames/s", image.source,
-				image.frameRate);
+		WH_LOG_DEBUG("Source %llu streaming at %u frames/s", feed.image.source,
+				feed.image.frameRate);
 		if (message->getPayloadLength() >= sizeof(uint32_t) + 60) {
-			location.timestamp = message->getDouble(8);
-			location.latitude = message->getDouble(16);
-			location.longitude = message->getDouble(24);
+			feed.location.timestamp = message->getDouble(8);
+			feed.location.latitude = message->getDouble(16);
+			feed.location.longitude = message->getDouble(24);
+			feed.captions = feed.captions || window.showLocation;
 			WH_LOG_DEBUG("Source %llu reported TS:%f, LAT:%f, LONG:%f",
-					image.source, location.timestamp, location.latitude,
-					location.longitude);
+					feed.image.source, feed.location.timestamp,
+					feed.location.latitude, feed.location.longitude);
 		}
 	}
 	return 0;
 }
 
-void Viewer::resetSink() {
-	try {
-		if (sink.reset) {
-			hideWindow();
-			memset(sink.name, 0, sizeof(sink.name));
-			snprintf(sink.name, sizeof(sink.name),
-					"Stream %llu [%u x %u] @%u frames/s", image.source,
-					image.width, image.height, image.frameRate);
+void Viewer::updateLocation(Feed &feed, Message *message) noexcept {
+	//Geotag: mode, capture time, latitude, longitude, altitude, heading
+	if (message->getPayloadLength() < 4 * sizeof(uint32_t) + 40) {
+		return;
+	}
 
-			if (!sink.writeVideo) {
-				sink.reset = false;
-				return;
+	auto mode = message->getData32(3 * sizeof(uint32_t));
+	if (mode == 2 || mode == 3) {
+		feed.location.timestamp = message->getDouble(16);
+		feed.location.latitude = message->getDouble(24);
+		feed.location.longitude = message->getDouble(32);
+		feed.captions = feed.captions || window.showLocation;
+	}
+}
+
+void Viewer::updateAttitude(Feed &feed, Message *message) noexcept {
+	//Count, interval, timestamp, scales, delta encoded samples
+	constexpr unsigned int METADATA = 2 * sizeof(uint32_t) + 3 * sizeof(double);
+	constexpr unsigned int CHANNELS = 6;
+	if (message->getPayloadLength() <= METADATA) {
+		return;
+	}
+
+	auto count = Twiddler::min(message->getData32(0), MAX_INERTIAL);
+	int16_t samples[MAX_INERTIAL][CHANNELS];
+	count = DeltaCodec::decode(message->getBytes(METADATA),
+			message->getPayloadLength() - METADATA, CHANNELS, &samples[0][0],
+			count);
+	if (!count) {
+		return;
+	}
+
+	//Tilt of the latest sample from the gravity vector
+	auto interval = message->getData32(sizeof(uint32_t)) / 1000000.0;
+	auto scale = message->getDouble(2 * sizeof(uint32_t) + sizeof(double));
+	auto x = samples[count - 1][0] * scale;
+	auto y = samples[count - 1][1] * scale;
+	auto z = samples[count - 1][2] * scale;
+	feed.attitude.timestamp = message->getDouble(2 * sizeof(uint32_t))
+			+ (count - 1) * interval;
+	feed.attitude.roll = atan2(y, z) * 180 / M_PI;
+	feed.attitude.pitch = atan2(-x, sqrt(y * y + z * z)) * 180 / M_PI;
+	feed.attitude.valid = true;
+	feed.captions = feed.captions || window.showLocation;
+}
+
+void Viewer::updateSchema(Feed &feed, Message *message) noexcept {
+	//Sensor, interval, fields, name, (field name, unit)...
+	constexpr unsigned int HEADER = 3 * sizeof(uint32_t) + 16;
+	if (message->getPayloadLength() < HEADER) {
+		return;
+	}
+
+	auto id = message->getData32(0);
+	auto fields = message->getData32(2 * sizeof(uint32_t));
+	if (id >= MAX_SENSORS || fields > SENSOR_FIELDS
+			|| message->getPayloadLength() < HEADER + fields * 24) {
+		return;
+	}
+
+	auto &sensor = feed.sensors[id];
+	auto bytes = message->getBytes(3 * sizeof(uint32_t));
+	memcpy(sensor.name, bytes, sizeof(sensor.name));
+	sensor.name[sizeof(sensor.name) - 1] = '\0';
+	for (unsigned int i = 0; i < fields; ++i) {
+		memcpy(sensor.units[i], bytes + 16 + i * 24 + 16,
+				sizeof(sensor.units[i]));
+		sensor.units[i][sizeof(sensor.units[i]) - 1] = '\0';
+	}
+	sensor.fields = fields;
+	sensor.described = true;
+}
+
+void Viewer::updateTelemetry(Feed &feed, Message *message) noexcept {
+	//Count, (sensor << 16 | fields, timestamp, values)...
+	if (message->getPayloadLength() < sizeof(uint32_t)) {
+		return;
+	}
+
+	auto count = message->getData32(0);
+	unsigned int offset = sizeof(uint32_t);
+	for (unsigned int i = 0; i < count; ++i) {
+		if (message->getPayloadLength() < offset + sizeof(uint32_t)) {
+			break;
+		}
+
+		auto tag = message->getData32(offset);
+		auto id = tag >> 16;
+		auto fields = tag & 0xFFFF;
+		auto size = sizeof(uint32_t) + sizeof(double) * (1 + fields);
+		if (message->getPayloadLength() < offset + size) {
+			break;
+		} else if (id < MAX_SENSORS && fields <= SENSOR_FIELDS
+				&& feed.sensors[id].described
+				&& feed.sensors[id].fields == fields) {
+			//Keep the latest reading
+			auto &sensor = feed.sensors[id];
+			sensor.timestamp = message->getDouble(offset + sizeof(uint32_t));
+			for (unsigned int j = 0; j < fields; ++j) {
+				sensor.values[j] = message->getDouble(
+						offset + sizeof(uint32_t) + (j + 1) * sizeof(double));
 			}
+			sensor.sampled = true;
+			feed.captions = feed.captions || !window.showLocation;
+		}
+		offset += size;
+	}
+}
 
-			if (!sink.fourcc || strlen(sink.fourcc) != 4) {
-				throw Exception(EX_PARAMETER);
+void Viewer::updateMotion(Feed &feed, Message *message) noexcept {
+	//State, timestamp, area, x, y, width, height
+	constexpr unsigned int OFFSET = sizeof(uint32_t) + sizeof(double);
+	if (message->getPayloadLength() < OFFSET + 5 * sizeof(uint32_t)) {
+		return;
+	}
+
+	auto &motion = feed.motion;
+	auto active = (message->getData32(0) != 0);
+	auto changed = (active != motion.active || !motion.reported);
+	motion.timestamp = message->getDouble(sizeof(uint32_t));
+	motion.area = message->getData32(OFFSET);
+	for (unsigned int i = 0; i < 4; ++i) {
+		motion.box[i] = message->getData32(OFFSET + (i + 1) * sizeof(uint32_t));
+	}
+	motion.active = active;
+	motion.reported = true;
+
+	if (!changed) {
+		return;
+	} else if (active) {
+		WH_LOG_INFO("Source %llu: motion (%u/1000 at %d, %d, %dx%d)",
+				feed.image.source, motion.area, motion.box[0], motion.box[1],
+				motion.box[2], motion.box[3]);
+	} else {
+		WH_LOG_INFO("Source %llu: idle", feed.image.source);
+	}
+	feed.captions = feed.captions || !window.showLocation;
+}
+
+void Viewer::formatTelemetry(const Feed &feed, char *text,
+		unsigned int size) const noexcept {
+	//<name> <value><unit>... | <name> ...
+	unsigned int length = 0;
+	text[0] = '\0';
+	for (auto &sensor : feed.sensors) {
+		if (!sensor.sampled || length >= size) {
+			continue;
+		}
+
+		length += snprintf(text + length, size - length, "%s%s",
+				(length ? " | " : ""), sensor.name);
+		for (unsigned int i = 0; i < sensor.fields && length < size; ++i) {
+			length += snprintf(text + length, size - length, " %.1f%s",
+					sensor.values[i], sensor.units[i]);
+		}
+	}
+}
+
+void Viewer::resetSink(Feed &feed) {
+	try {
+		auto &image = feed.image;
+		if (feed.sink.reset) {
+			if (mosaic.isSingle()) {
+				hideWindow();
+				memset(window.name, 0, sizeof(window.name));
+				snprintf(window.name, sizeof(window.name),
+						"Stream %llu [%u x %u] @%u frames/s", image.source,
+						image.width, image.height, image.frameRate);
+			}
+
+			if (!ctx.writeVideo) {
+				feed.sink.reset = false;
+				return;
 			}
 
 			char t[32];
@@ -333,18 +668,19 @@ void Viewer::resetSink() {
 				throw Exception(EX_OPERATION);
 			}
 
-			memset(sink.fileName, 0, sizeof(sink.fileName));
-			snprintf(sink.fileName, sizeof(sink.fileName),
-					"c%llu-r%u_x_%u-f%u-t%s.avi", image.source, image.width,
+			memset(feed.sink.fileName, 0, sizeof(feed.sink.fileName));
+			snprintf(feed.sink.fileName, sizeof(feed.sink.fileName),
+					"c%llu-r%u_x_%u-f%u-t%s", image.source, image.width,
 					image.height, image.frameRate, t);
 
-			if (!sink.writer.open(sink.fileName,
-					sink.writer.fourcc(sink.fourcc[0], sink.fourcc[1],
-							sink.fourcc[2], sink.fourcc[3]), image.frameRate,
-					cv::Size(image.width, image.height), true)) {
-				throw Exception(EX_OPERATION);
-			}
-			sink.reset = false;
+			RecordingHeader header;
+			memset(&header, 0, sizeof(header));
+			header.source = image.source;
+			header.width = image.width;
+			header.height = image.height;
+			header.frameRate = image.frameRate;
+			feed.sink.recorder.open(feed.sink.fileName, header);
+			feed.sink.reset = false;
 		}
 	} catch (BaseException &e) {
 		throw;
@@ -353,80 +689,215 @@ void Viewer::resetSink() {
 	}
 }
 
+void Viewer::recordImage(Feed &feed) noexcept {
+	try {
+		if (feed.sink.recorder.isOpen()) {
+			//Aligned with the source's GPS track by the capture time
+			auto timestamp = (unsigned long long) (feed.image.timestamp * 1000);
+			if (!timestamp) {
+				timespec ts;
+				clock_gettime(CLOCK_REALTIME, &ts);
+				timestamp = ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000;
+			}
+			feed.sink.recorder.write(feed.image.data, feed.image.bytes,
+					timestamp);
+		}
+	} catch (BaseException &e) {
+		WH_LOG_EXCEPTION(e);
+		WH_LOG_DEBUG("Recording stopped");
+		feed.sink.recorder.close();
+	}
+}
+
 void Viewer::processKeyPress(int keyCode) {
-	if (keyCode == 255) {
+	if (keyCode == 255 || !count) {
 		return;
 	}
 
+	auto &feed = feeds[window.selected];
+	auto &gimbal = feed.gimbal;
+	int speed = ctx.servoSpeed;
 	switch (keyCode) {
+	case '\t': //Select the next stream
+		if (gimbal.pan || gimbal.tilt) {
+			gimbal.pan = 0;
+			gimbal.tilt = 0;
+			sendVelocity(feed);
+		}
+		window.selected = (window.selected + 1) % count;
+		mosaic.select(window.selected);
+		return;
+	case 'g': //Select the next gimbal of the stream
+	case 'G':
+		if (gimbal.pan || gimbal.tilt) {
+			gimbal.pan = 0;
+			gimbal.tilt = 0;
+			sendVelocity(feed);
+		}
+		gimbal.index = (gimbal.index + 1) % MAX_GIMBALS;
+		gimbal.patrol = false;
+		gimbal.tracking = false;
+		feed.captions = true;
+		return;
 	case 'w': //UP
 	case 'W':
-		gimbal.tilt += 5;
-		if (gimbal.tilt > 60) {
-			gimbal.tilt = 60;
+		if (gimbal.tilt == speed) {
 			return;
 		}
+		gimbal.tilt = speed;
 		break;
 	case 's': //DOWN
 	case 'S':
-		gimbal.tilt -= 5;
-		if (gimbal.tilt < -60) {
-			gimbal.tilt = -60;
+		if (gimbal.tilt == -speed) {
 			return;
 		}
+		gimbal.tilt = -speed;
 		break;
 	case 'd': //RIGHT
 	case 'D':
-		gimbal.pan -= 5;
-		if (gimbal.pan < -85) {
-			gimbal.pan = -85;
+		if (gimbal.pan == -speed) {
 			return;
 		}
+		gimbal.pan = -speed;
 		break;
 	case 'a': //LEFT
 	case 'A':
-		gimbal.pan += 5;
-		if (gimbal.pan > 85) {
-			gimbal.pan = 85;
+		if (gimbal.pan == speed) {
 			return;
 		}
+		gimbal.pan = speed;
+		break;
+	case ' ': //STOP
+		gimbal.pan = 0;
+		gimbal.tilt = 0;
 		break;
+	case '0': //Go to a preset
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':
+		gimbal.pan = 0;
+		gimbal.tilt = 0;
+		gimbal.patrol = false;
+		gimbal.tracking = false;
+		sendCommand(feed, 3, keyCode - '0');
+		return;
+	case 't': //Start/stop the patrol
+	case 'T':
+		gimbal.pan = 0;
+		gimbal.tilt = 0;
+		gimbal.patrol = !gimbal.patrol;
+		gimbal.tracking = false;
+		sendCommand(feed, 4, (gimbal.patrol ? 1 : 0));
+		return;
+	case 'f': //Start/stop following the motion
+	case 'F':
+		gimbal.pan = 0;
+		gimbal.tilt = 0;
+		gimbal.patrol = false;
+		gimbal.tracking = !gimbal.tracking;
+		sendCommand(feed, 5, (gimbal.tracking ? 1 : 0));
+		feed.captions = true;
+		return;
 	case 'l':
 	case 'L':
-		location.show = location.show ? false : true; //toggle
+		window.showLocation = window.showLocation ? false : true; //toggle
+		for (unsigned int i = 0; i < count; ++i) {
+			feeds[i].captions = true;
+		}
 		return;
 	default:
 		return;
 	}
 
+	//Any motion ends the patrol and the tracking
+	gimbal.patrol = false;
+	gimbal.tracking = false;
+	sendVelocity(feed);
+}
+
+void Viewer::sendVelocity(Feed &feed) noexcept {
+	Message *message = Message::create();
+	if (message) {
+		MessageHeader header;
+		header.setAddress(0, feed.peer.id);
+		header.setControl(Message::HEADER_SIZE, flow.nextSequenceNumber(), 0);
+		header.setContext(0, 2, WH_AQLF_REQUEST);
+		message->putHeader(header);
+		message->appendData32((uint32_t) feed.gimbal.pan);
+		message->appendData32((uint32_t) feed.gimbal.tilt);
+		message->appendData32(feed.gimbal.index);
+		message->setDestination(0); //Route via overlay network
+		sendMessage(message);
+		feed.gimbal.sent = monotonic();
+	}
+}
+
+void Viewer::sendCommand(Feed &feed, unsigned int qualifier,
+		unsigned int value) noexcept {
 	Message *message = Message::create();
 	if (message) {
 		MessageHeader header;
-		header.setAddress(0, peer.id);
+		header.setAddress(0, feed.peer.id);
 		header.setControl(Message::HEADER_SIZE, flow.nextSequenceNumber(), 0);
-		header.setContext(0, 1, WH_AQLF_REQUEST);
+		header.setContext(0, qualifier, WH_AQLF_REQUEST);
 		message->putHeader(header);
-		message->appendData32(gimbal.pan + 90);
-		message->appendData32(gimbal.tilt + 90);
+		message->appendData32(value);
+		message->appendData32(feed.gimbal.index);
 		message->setDestination(0); //Route via overlay network
 		sendMessage(message);
 	}
 }
 
+void Viewer::keepMoving() noexcept {
+	auto now = monotonic();
+	for (unsigned int i = 0; i < count; ++i) {
+		auto &feed = feeds[i];
+		if ((feed.gimbal.pan || feed.gimbal.tilt)
+				&& (now - feed.gimbal.sent) >= ctx.keepAlive) {
+			sendVelocity(feed);
+		}
+	}
+}
+
 void Viewer::hideWindow() noexcept {
 	try {
-		if (sink.name[0]) {
-			cv::destroyWindow(sink.name);
+		if (window.name[0] && window.visible) {
+			cv::destroyWindow(window.name);
 		}
 	} catch (...) {
 	}
+	window.visible = false;
+}
+
+unsigned int Viewer::find(unsigned long long source) const noexcept {
+	for (unsigned int i = 0; i < count; ++i) {
+		if (source && feeds[i].image.source == source) {
+			return i;
+		}
+	}
+	return count;
 }
 
 void Viewer::clear() noexcept {
-	memset(&peer, 0, sizeof(peer));
-	memset(&image, 0, sizeof(image));
-	memset(&gimbal, 0, sizeof(gimbal));
-	memset(&location, 0, sizeof(location));
+	for (auto &feed : feeds) {
+		memset(&feed.peer, 0, sizeof(feed.peer));
+		memset(&feed.image, 0, sizeof(feed.image));
+		memset(&feed.gimbal, 0, sizeof(feed.gimbal));
+		memset(&feed.location, 0, sizeof(feed.location));
+		memset(&feed.attitude, 0, sizeof(feed.attitude));
+		memset(&feed.sensors, 0, sizeof(feed.sensors));
+		memset(&feed.motion, 0, sizeof(feed.motion));
+		feed.sink.reset = false;
+		feed.captions = true;
+	}
+	count = 0;
+	memset(&window, 0, sizeof(window));
 }
 
 } /* namespace wanhive */
@@ -21,6 +21,10 @@
 
 #ifndef CLIENT_VIEWER_H_
 #define CLIENT_VIEWER_H_
+#include "../media/Mosaic.h"
+#include "../media/Recorder.h"
+#include "../device/Sensor.h"
+#include "../util/DeltaCodec.h"
 #include <wanhive/wanhive.h>
 #include <opencv2/opencv.hpp>
 
@@ -30,8 +34,12 @@ class Viewer final: public ClientHub {
 public:
 	Viewer(unsigned long long uid, unsigned long long streamerId,
 			const char *path = nullptr) noexcept;
+	//Subscribes to <count> streamers (at most MAX_STREAMS)
+	Viewer(unsigned long long uid, const unsigned long long *streamers,
+			unsigned int count, const char *path = nullptr) noexcept;
 	virtual ~Viewer();
 private:
+	struct Feed;
 	void configure(void *arg) override;
 	void cleanup() noexcept override;
 	void route(Message *message) noexcept override;
@@ -39,78 +47,171 @@ private:
 	void processAlarm(unsigned long long uid, unsigned long long ticks) noexcept
 			override;
 
-	//Send a heartbeat message, request <frames> frames from the source <id>
-	void sendHeartbeat(unsigned long long id, unsigned int frames) noexcept;
+	//Send a heartbeat message, request <frames> frames from the feed's source
+	void sendHeartbeat(Feed &feed, unsigned int frames) noexcept;
 	//Reset the source identifier of the image
-	bool resetSource(unsigned long long id, unsigned int frameRate,
+	bool resetSource(Feed &feed, unsigned long long id, unsigned int frameRate,
 			unsigned int sequence) noexcept;
-	//Start a new jpeg frame
-	void resetFrame(unsigned int size, unsigned int width, unsigned int height,
-			unsigned int sequenceNumber) noexcept;
+	//Start a new jpeg frame captured at <timestamp> (0: unknown)
+	void resetFrame(Feed &feed, unsigned int size, unsigned int width,
+			unsigned int height, unsigned int sequenceNumber,
+			double timestamp) noexcept;
 	//Populate the Jpeg frame
-	void populateFrame(const unsigned char *data, unsigned int bytes) noexcept;
-	//Display the image in a desktop window
-	void processImage() noexcept;
+	void populateFrame(Feed &feed, const unsigned char *data,
+			unsigned int bytes) noexcept;
+	//Send the image of the given feed to the mosaic
+	void processImage(unsigned int index) noexcept;
+	//Display the mosaic in a desktop window
+	void refresh() noexcept;
 	//Handle the response to a pairing request sent out by the heartbeat function
 	int handlePairingResponse(Message *message) noexcept;
 
+	//Update the location from the frame's geotag (if any)
+	void updateLocation(Feed &feed, Message *message) noexcept;
+	//Update the attitude from the inertial data
+	void updateAttitude(Feed &feed, Message *message) noexcept;
+	//Update the schema of a sensor
+	void updateSchema(Feed &feed, Message *message) noexcept;
+	//Update the sensor readings from a telemetry batch
+	void updateTelemetry(Feed &feed, Message *message) noexcept;
+	//Update the motion state of the source
+	void updateMotion(Feed &feed, Message *message) noexcept;
+	//Format the latest sensor readings of the <feed> into <text>
+	void formatTelemetry(const Feed &feed, char *text,
+			unsigned int size) const noexcept;
 	//Reset the viewer and the video file
-	void resetSink();
+	void resetSink(Feed &feed);
+	//Append the current image to the recording
+	void recordImage(Feed &feed) noexcept;
 	//Process keyboard inputs
 	void processKeyPress(int keyCode);
+	//Request continuous motion of the feed's gimbal
+	void sendVelocity(Feed &feed) noexcept;
+	//Send a gimbal control request with a single argument
+	void sendCommand(Feed &feed, unsigned int qualifier,
+			unsigned int value) noexcept;
+	//Renew the continuous motion requests before they expire
+	void keepMoving() noexcept;
 	//Hide the window
 	void hideWindow() noexcept;
+	//Returns the feed streaming from the <source> (count if none)
+	unsigned int find(unsigned long long source) const noexcept;
 	void clear() noexcept;
 public:
 	static constexpr unsigned long MAX_IMAGE_SIZE = 65536 * 4;
+	static constexpr unsigned int MAX_STREAMS = 16;
+	//Maximum number of gimbals per stream
+	static constexpr unsigned int MAX_GIMBALS = 4;
+	//Maximum number of inertial samples in a message
+	static constexpr unsigned int MAX_INERTIAL = 256;
+	//Maximum number of sensors per stream
+	static constexpr unsigned int MAX_SENSORS = 16;
+	//Minimum interval between the window refreshes (in milliseconds)
+	static constexpr unsigned int DISPLAY_INTERVAL = 30;
 private:
-	struct {
-		unsigned long long id; //Desired peer identifier
-		unsigned int sequence; //Desired sequence identifier
-	} peer;
+	struct Feed {
+		struct {
+			unsigned long long id; //Desired peer identifier
+			unsigned int sequence; //Desired sequence identifier
+		} peer;
 
-	struct {
-		//Currently designated source of this image
-		unsigned long long source;
-		//Frame rate reported by the current source
-		unsigned int frameRate;
-		//Number of frames received since the last reset
-		unsigned int frames;
-		//Sequence number of the current frame
-		unsigned int sequence;
-		//Expected size of the image
-		unsigned int size;
-		//Bytes transferred so far by the source
-		unsigned int bytes;
-		//Frame width
-		unsigned int width;
-		//Frame height
-		unsigned int height;
-		//Image data
-		unsigned char data[MAX_IMAGE_SIZE];
-	} image;
+		struct {
+			//Currently designated source of this image
+			unsigned long long source;
+			//Frame rate reported by the current source
+			unsigned int frameRate;
+			//Number of frames received since the last reset
+			unsigned int frames;
+			//Sequence number of the current frame
+			unsigned int sequence;
+			//Expected size of the image
+			unsigned int size;
+			//Bytes transferred so far by the source
+			unsigned int bytes;
+			//Frame width
+			unsigned int width;
+			//Frame height
+			unsigned int height;
+			//Capture time reported by the source (0: unknown)
+			double timestamp;
+			//Image data
+			unsigned char data[MAX_IMAGE_SIZE];
+		} image;
 
-	struct {
-		int pan;
-		int tilt;
-	} gimbal;
+		struct {
+			int pan; //Pan rate (degrees per second)
+			int tilt; //Tilt rate (degrees per second)
+			unsigned long long sent; //Time of the last request
+			unsigned int index; //Selected gimbal
+			bool patrol; //Patrolling
+			bool tracking; //Following the motion
+		} gimbal;
+
+		struct {
+			char fileName[PATH_MAX];
+			Recorder recorder;
+			bool reset { false };
+		} sink;
+
+		struct {
+			double timestamp;
+			double latitude;
+			double longitude;
+		} location;
+
+		struct {
+			double timestamp;
+			float roll; //Degrees
+			float pitch; //Degrees
+			bool valid;
+		} attitude;
+
+		//Sensors and their latest readings
+		struct {
+			char name[16];
+			unsigned int fields;
+			char units[SENSOR_FIELDS][8];
+			double timestamp;
+			double values[SENSOR_FIELDS];
+			bool described; //Schema received
+			bool sampled; //Reading received
+		} sensors[MAX_SENSORS];
+
+		//Motion state reported by the source
+		struct {
+			double timestamp;
+			unsigned int area; //Per mille of the frame
+			int box[4]; //Largest blob: x, y, width, height
+			bool active;
+			bool reported; //The source detects motion
+		} motion;
+
+		//Captions need an update
+		bool captions;
+	};
+
+	Feed feeds[MAX_STREAMS];
+	unsigned int count; //Number of feeds
 
 	struct {
-		const char *fourcc { nullptr };
-		char name[256];
-		char fileName[PATH_MAX];
-		cv::VideoWriter writer;
-		bool reset { false };
-		bool writeVideo { false };
-	} sink;
+		char name[256]; //Window name
+		unsigned long long shown; //Time of the last refresh
+		unsigned int selected; //Feed controlled by the keyboard
+		bool visible;
+		bool showLocation;
+	} window;
 
 	struct {
-		double timestamp;
-		double latitude;
-		double longitude;
-		bool show;
-	} location;
+		cv::Size tileSize;
+		unsigned int workers;
+		unsigned int servoSpeed; //Degrees per second
+		unsigned int keepAlive; //Motion renewal interval (milliseconds)
+		unsigned int heartbeat { 0 }; //Heartbeat interval (milliseconds)
+		unsigned long long beat { 0 }; //Time of the last heartbeat
+		bool writeVideo { false };
+	} ctx;
 
+	Mosaic mosaic;
 	FlowControl flow; //Flow control
 };
 
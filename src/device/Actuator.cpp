@@ -0,0 +1,262 @@
+/*
+ * Actuator.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Actuator.h"
+#include <wanhive/wanhive-base.h>
+#include <algorithm>
+
+namespace {
+
+enum : unsigned int {
+	POSITION, VELOCITY, PATROL
+};
+
+}  // namespace
+
+namespace wanhive {
+
+Actuator::Actuator(Gimbal *gimbal, const Settings &settings) :
+		gimbal(gimbal), settings(settings), running(true), failed(false) {
+	if (!gimbal) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	this->settings.rate = Twiddler::min(
+			Twiddler::max(settings.rate, MIN_RATE), MAX_RATE);
+	axes.pan.setLimits(settings.pan.speed, settings.pan.acceleration);
+	axes.tilt.setLimits(settings.tilt.speed, settings.tilt.acceleration);
+	command.pan = 0;
+	command.tilt = 0;
+	command.type = POSITION;
+	command.pending = false;
+	motion.pan = 0;
+	motion.tilt = 0;
+	motion.active = false;
+	tour.index = 0;
+	tour.dwelling = false;
+	tour.active = false;
+	this->settings.stops = Twiddler::min(settings.stops, MAX_STOPS);
+	try {
+		worker = std::thread(&Actuator::work, this);
+	} catch (...) {
+		delete gimbal;
+		throw Exception(EX_RESOURCE);
+	}
+}
+
+Actuator::~Actuator() {
+	stop();
+	delete gimbal;
+}
+
+bool Actuator::post(float pan, float tilt) noexcept {
+	return post(POSITION, pan, tilt);
+}
+
+bool Actuator::drive(float panRate, float tiltRate) noexcept {
+	return post(VELOCITY, panRate, tiltRate);
+}
+
+bool Actuator::patrol(bool start) noexcept {
+	return post(PATROL, (start ? 1 : 0), 0);
+}
+
+bool Actuator::hasFailed() const noexcept {
+	std::lock_guard<std::mutex> lock(mutex);
+	return failed;
+}
+
+void Actuator::work() noexcept {
+	try {
+		gimbal->reset();
+		axes.pan.reset(gimbal->getPan());
+		axes.tilt.reset(gimbal->getTilt());
+
+		auto dt = 1.0f / settings.rate;
+		auto period = std::chrono::duration_cast<Clock::duration>(
+				std::chrono::duration<float>(dt));
+		auto tick = Clock::now();
+		while (next(tick)) {
+			advance(dt);
+			auto pan = axes.pan.step(dt);
+			auto tilt = axes.tilt.step(dt);
+			gimbal->setPanTilt(pan, tilt);
+			//Don't try to catch up after an overrun
+			tick = std::max(tick + period, Clock::now());
+		}
+		return;
+	} catch (BaseException &e) {
+		WH_LOG_EXCEPTION(e);
+	} catch (...) {
+		WH_LOG_EXCEPTION_U();
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	failed = true;
+}
+
+bool Actuator::next(Clock::time_point &tick) {
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true) {
+		if (isMoving()) {
+			//New commands are picked up at the next tick
+			condition.wait_until(lock, tick, [this] {
+				return !running;
+			});
+		} else if (tour.active) {
+			condition.wait_until(lock, tour.until, [this] {
+				return !running || command.pending;
+			});
+			tick = Clock::now();
+		} else {
+			condition.wait(lock, [this] {
+				return !running || command.pending;
+			});
+			tick = Clock::now();
+		}
+
+		if (!running) {
+			return false;
+		}
+
+		apply();
+		visit();
+		if (isMoving()) {
+			return true;
+		}
+	}
+}
+
+bool Actuator::post(unsigned int type, float pan, float tilt) noexcept {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (failed) {
+			return false;
+		}
+
+		command.pan = pan;
+		command.tilt = tilt;
+		command.timestamp = Clock::now();
+		command.type = type;
+		command.pending = true;
+	}
+	condition.notify_one();
+	return true;
+}
+
+void Actuator::apply() noexcept {
+	if (!command.pending) {
+		return;
+	}
+
+	command.pending = false;
+	if (settings.timeout
+			&& (Clock::now() - command.timestamp)
+					> std::chrono::milliseconds(settings.timeout)) {
+		WH_LOG_DEBUG("Stale gimbal command dropped");
+		return;
+	}
+
+	//Any command ends the patrol
+	tour.active = false;
+	switch (command.type) {
+	case VELOCITY:
+		motion.pan = command.pan;
+		motion.tilt = command.tilt;
+		motion.expiry = command.timestamp
+				+ std::chrono::milliseconds(settings.deadline);
+		motion.active = (command.pan != 0 || command.tilt != 0);
+		break;
+	case PATROL:
+		motion.active = false;
+		if (command.pan != 0 && settings.stops) {
+			tour.index = 0;
+			tour.dwelling = false;
+			tour.active = true;
+			axes.pan.setTarget(settings.tour[0].pan);
+			axes.tilt.setTarget(settings.tour[0].tilt);
+		}
+		break;
+	default:
+		motion.active = false;
+		axes.pan.setTarget(command.pan);
+		axes.tilt.setTarget(command.tilt);
+		break;
+	}
+}
+
+void Actuator::advance(float dt) noexcept {
+	if (!motion.active) {
+		return;
+	} else if (settings.deadline && Clock::now() > motion.expiry) {
+		WH_LOG_DEBUG("Gimbal motion expired");
+		motion.active = false;
+		return;
+	}
+
+	//The axes stop at the end points
+	auto pan = axes.pan.getTarget() + motion.pan * dt;
+	pan = std::min(std::max(pan, (float) Gimbal::PAN_MIN),
+			(float) Gimbal::PAN_MAX);
+	axes.pan.setTarget(pan);
+
+	auto tilt = axes.tilt.getTarget() + motion.tilt * dt;
+	tilt = std::min(std::max(tilt, (float) Gimbal::TILT_MIN),
+			(float) Gimbal::TILT_MAX);
+	axes.tilt.setTarget(tilt);
+}
+
+void Actuator::visit() noexcept {
+	if (!tour.active || !axes.pan.isIdle() || !axes.tilt.isIdle()) {
+		return;
+	}
+
+	auto now = Clock::now();
+	if (!tour.dwelling) {
+		//Arrived at the stop
+		tour.dwelling = true;
+		tour.until = now
+				+ std::chrono::milliseconds(settings.tour[tour.index].dwell);
+	} else if (now >= tour.until) {
+		tour.dwelling = false;
+		tour.index = (tour.index + 1) % settings.stops;
+		axes.pan.setTarget(settings.tour[tour.index].pan);
+		axes.tilt.setTarget(settings.tour[tour.index].tilt);
+	}
+}
+
+bool Actuator::isMoving() const noexcept {
+	return motion.active || !axes.pan.isIdle() || !axes.tilt.isIdle();
+}
+
+void Actuator::stop() noexcept {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	condition.notify_all();
+	if (worker.joinable()) {
+		worker.join();
+	}
+}
+
+} /* namespace wanhive */
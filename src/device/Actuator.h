@@ -0,0 +1,155 @@
+/*
+ * Actuator.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_ACTUATOR_H_
+#define DEVICE_ACTUATOR_H_
+#include "Gimbal.h"
+#include "Trajectory.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace wanhive {
+/**
+ * Drives a gimbal from a dedicated thread
+ * Commands are posted into a single-slot mailbox: a new command replaces the
+ * pending one, and a command which waited longer than the timeout before the
+ * thread could pick it up is dropped. The gimbal moves towards the commanded
+ * angles along trapezoidal velocity profiles, updated at a fixed rate.
+ * Continuous motion (velocity) commands must be renewed before the deadline
+ * expires, otherwise the gimbal stops. A patrol visits the stops of the tour
+ * in a loop, dwelling at each of them, until any other command arrives.
+ */
+class Actuator {
+public:
+	static constexpr unsigned int MAX_STOPS = 16;
+	//Patrol tour stop
+	struct Stop {
+		float pan;
+		float tilt;
+		unsigned int dwell; //Milliseconds
+	};
+
+	struct Settings {
+		unsigned int timeout; //Command expiration in milliseconds (0: never)
+		unsigned int rate; //Trajectory updates per second
+		unsigned int deadline; //Continuous motion expiration (milliseconds)
+		//Speed (degrees/s) and acceleration (degrees/s^2), 0: no limit
+		struct {
+			float speed;
+			float acceleration;
+		} pan, tilt;
+		Stop tour[MAX_STOPS]; //Patrol tour
+		unsigned int stops; //Number of stops in the tour
+	};
+
+	/*
+	 * Takes ownership of the <gimbal> and starts the actuator thread
+	 */
+	Actuator(Gimbal *gimbal, const Settings &settings);
+	~Actuator();
+	/*
+	 * Posts a pan/tilt command (degrees), replaces the pending command.
+	 * Returns false if the gimbal has failed.
+	 */
+	bool post(float pan, float tilt) noexcept;
+	/*
+	 * Posts a continuous motion command (degrees per second), replaces the
+	 * pending command. Zero rates stop the motion. Returns false if the gimbal
+	 * has failed.
+	 */
+	bool drive(float panRate, float tiltRate) noexcept;
+	/*
+	 * Starts or stops the patrol (the tour is set at construction). Returns
+	 * false if the gimbal has failed.
+	 */
+	bool patrol(bool start) noexcept;
+	/*
+	 * Returns true if the gimbal has failed (the thread has exited)
+	 */
+	bool hasFailed() const noexcept;
+private:
+	void work() noexcept;
+	bool post(unsigned int type, float pan, float tilt) noexcept;
+	//Applies the pending command
+	void apply() noexcept;
+	//Advances the targets of the continuous motion by <dt> seconds
+	void advance(float dt) noexcept;
+	//Moves along the patrol tour if the gimbal has reached the target
+	void visit() noexcept;
+	bool isMoving() const noexcept;
+	/*
+	 * Waits for the next trajectory update (until <tick> if the gimbal is in
+	 * motion, for a command or the end of the dwell time otherwise). Returns
+	 * false on stop.
+	 */
+	bool next(std::chrono::steady_clock::time_point &tick);
+	void stop() noexcept;
+private:
+	using Clock = std::chrono::steady_clock;
+	Gimbal *gimbal;
+	Settings settings;
+
+	struct {
+		float pan;
+		float tilt;
+		Clock::time_point timestamp;
+		unsigned int type; //Position, velocity or patrol
+		bool pending;
+	} command;
+
+	//Accessed only by the actuator thread
+	struct {
+		Trajectory pan;
+		Trajectory tilt;
+	} axes;
+
+	//Continuous motion, accessed only by the actuator thread
+	struct {
+		float pan;
+		float tilt;
+		Clock::time_point expiry;
+		bool active;
+	} motion;
+
+	//Patrol, accessed only by the actuator thread
+	struct {
+		unsigned int index; //Current stop
+		Clock::time_point until; //End of the dwell time
+		bool dwelling;
+		bool active;
+	} tour;
+
+	mutable std::mutex mutex;
+	std::condition_variable condition;
+	std::thread worker;
+	bool running;
+	bool failed;
+public:
+	static constexpr unsigned int MIN_RATE = 1;
+	static constexpr unsigned int MAX_RATE = 200;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_ACTUATOR_H_ */
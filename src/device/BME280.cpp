@@ -0,0 +1,218 @@
+/*
+ * BME280.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "BME280.h"
+#include <wanhive/wanhive-base.h>
+
+namespace {
+
+constexpr unsigned char CALIB00_REG = 0x88; //dig_T1 to dig_H1 (26 bytes)
+constexpr unsigned char CHIP_ID_REG = 0xD0;
+constexpr unsigned char RESET_REG = 0xE0;
+constexpr unsigned char CALIB26_REG = 0xE1; //dig_H2 to dig_H6 (7 bytes)
+constexpr unsigned char CTRL_HUM_REG = 0xF2;
+constexpr unsigned char CTRL_MEAS_REG = 0xF4;
+constexpr unsigned char CONFIG_REG = 0xF5;
+constexpr unsigned char PRESS_MSB_REG = 0xF7; //Up to HUM_LSB (8 bytes)
+
+constexpr unsigned char CHIP_ID = 0x60;
+constexpr unsigned char RESET_COMMAND = 0xB6;
+constexpr unsigned char OVERSAMPLING_X1 = 0x01;
+constexpr unsigned char NORMAL_MODE = 0x03;
+constexpr unsigned int RESET_DELAY = 10; //Milliseconds
+
+//Standby times in milliseconds (config.t_sb)
+constexpr unsigned int STANDBY[] = { 1, 10, 20, 63, 125, 250, 500, 1000 };
+constexpr unsigned char STANDBY_CODES[] = { 0, 6, 7, 1, 2, 3, 4, 5 };
+
+//Data registers which have not been written (skipped or not measured yet)
+constexpr int SKIPPED = 0x80000;
+constexpr int HUMIDITY_SKIPPED = 0x8000;
+
+unsigned short u16(const unsigned char *bytes) noexcept {
+	return bytes[0] | (bytes[1] << 8);
+}
+
+short s16(const unsigned char *bytes) noexcept {
+	return (short) u16(bytes);
+}
+
+}  // namespace
+
+namespace wanhive {
+
+BME280::BME280(unsigned int bus, unsigned int device) :
+		I2C(bus, device), fine(0) {
+	setup();
+}
+
+BME280::BME280(const char *path, unsigned int device) :
+		I2C(path, device), fine(0) {
+	setup();
+}
+
+BME280::BME280(I2CBus *bus, unsigned int device) :
+		I2C(bus, device), fine(0) {
+	setup();
+}
+
+BME280::~BME280() {
+
+}
+
+unsigned int BME280::setInterval(unsigned int interval) {
+	unsigned int i = (sizeof(STANDBY) / sizeof(STANDBY[0])) - 1;
+	while (i && STANDBY[i] > interval) {
+		--i;
+	}
+
+	//No IIR filter, changes take effect in the sleep mode
+	I2C::write(CTRL_MEAS_REG, (unsigned char) 0);
+	I2C::write(CONFIG_REG, (unsigned char) (STANDBY_CODES[i] << 5));
+	I2C::write(CTRL_MEAS_REG,
+			(unsigned char) ((OVERSAMPLING_X1 << 5) | (OVERSAMPLING_X1 << 2)
+					| NORMAL_MODE));
+	schema.interval = Twiddler::max(interval, STANDBY[i]);
+	return STANDBY[i];
+}
+
+bool BME280::read(Environment &environment) {
+	//Pressure, temperature and humidity in a single burst
+	unsigned char data[8];
+	begin();
+	queueRead(PRESS_MSB_REG, sizeof(data), data);
+	commit();
+
+	auto pressure = (data[0] << 12) | (data[1] << 4) | (data[2] >> 4);
+	auto temperature = (data[3] << 12) | (data[4] << 4) | (data[5] >> 4);
+	auto humidity = (data[6] << 8) | data[7];
+	if (temperature == SKIPPED || pressure == SKIPPED
+			|| humidity == HUMIDITY_SKIPPED) {
+		return false;
+	}
+
+	environment.temperature = compensateTemperature(temperature);
+	environment.pressure = compensatePressure(pressure);
+	environment.humidity = compensateHumidity(humidity);
+	return true;
+}
+
+const SensorSchema& BME280::getSchema() const noexcept {
+	return schema;
+}
+
+bool BME280::sample(double *values) {
+	Environment environment;
+	if (!read(environment)) {
+		return false;
+	}
+
+	values[0] = environment.temperature;
+	values[1] = environment.pressure / 100;
+	values[2] = environment.humidity;
+	return true;
+}
+
+void BME280::setup() {
+	schema = { "BME280", 1000, 3, { { "Temperature", "C" },
+			{ "Pressure", "hPa" }, { "Humidity", "%" } } };
+
+	if (readByte(CHIP_ID_REG) != CHIP_ID) {
+		throw Exception(EX_RESOURCE);
+	}
+
+	I2C::write(RESET_REG, RESET_COMMAND);
+	Timer::sleep(RESET_DELAY);
+	calibrate();
+	I2C::write(CTRL_HUM_REG, OVERSAMPLING_X1);
+	setInterval(1000);
+}
+
+void BME280::calibrate() {
+	unsigned char low[26];
+	unsigned char high[7];
+	begin();
+	queueRead(CALIB00_REG, sizeof(low), low);
+	queueRead(CALIB26_REG, sizeof(high), high);
+	commit();
+
+	auto &c = calibration;
+	c.t1 = u16(low);
+	c.t2 = s16(low + 2);
+	c.t3 = s16(low + 4);
+	c.p1 = u16(low + 6);
+	c.p2 = s16(low + 8);
+	c.p3 = s16(low + 10);
+	c.p4 = s16(low + 12);
+	c.p5 = s16(low + 14);
+	c.p6 = s16(low + 16);
+	c.p7 = s16(low + 18);
+	c.p8 = s16(low + 20);
+	c.p9 = s16(low + 22);
+	c.h1 = low[25];
+	c.h2 = s16(high);
+	c.h3 = high[2];
+	//12-bit values sharing the nibbles of 0xE5
+	c.h4 = (short) (((signed char) high[3] << 4) | (high[4] & 0x0F));
+	c.h5 = (short) (((signed char) high[5] << 4) | (high[4] >> 4));
+	c.h6 = (signed char) high[6];
+}
+
+double BME280::compensateTemperature(int adc) noexcept {
+	auto &c = calibration;
+	auto v1 = (adc / 16384.0 - c.t1 / 1024.0) * c.t2;
+	auto v2 = (adc / 131072.0 - c.t1 / 8192.0);
+	v2 = v2 * v2 * c.t3;
+	fine = v1 + v2;
+	return fine / 5120.0;
+}
+
+double BME280::compensatePressure(int adc) const noexcept {
+	auto &c = calibration;
+	auto v1 = fine / 2.0 - 64000.0;
+	auto v2 = v1 * v1 * c.p6 / 32768.0;
+	v2 = v2 + v1 * c.p5 * 2.0;
+	v2 = v2 / 4.0 + c.p4 * 65536.0;
+	v1 = (c.p3 * v1 * v1 / 524288.0 + c.p2 * v1) / 524288.0;
+	v1 = (1.0 + v1 / 32768.0) * c.p1;
+	if (v1 == 0) {
+		return 0; //Avoid division by zero
+	}
+
+	auto p = 1048576.0 - adc;
+	p = (p - v2 / 4096.0) * 6250.0 / v1;
+	v1 = c.p9 * p * p / 2147483648.0;
+	v2 = p * c.p8 / 32768.0;
+	return p + (v1 + v2 + c.p7) / 16.0;
+}
+
+double BME280::compensateHumidity(int adc) const noexcept {
+	auto &c = calibration;
+	auto h = fine - 76800.0;
+	h = (adc - (c.h4 * 64.0 + c.h5 / 16384.0 * h))
+			* (c.h2 / 65536.0
+					* (1.0 + c.h6 / 67108864.0 * h * (1.0 + c.h3 / 67108864.0 * h)));
+	h = h * (1.0 - c.h1 * h / 524288.0);
+	return Twiddler::min(Twiddler::max(h, 0.0), 100.0);
+}
+
+} /* namespace wanhive */
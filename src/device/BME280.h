@@ -0,0 +1,88 @@
+/*
+ * BME280.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_BME280_H_
+#define DEVICE_BME280_H_
+#include "Sensor.h"
+#include "../interface/I2C.h"
+
+namespace wanhive {
+struct Environment {
+	double temperature; //Degree Celsius
+	double pressure; //Pascal
+	double humidity; //Relative humidity (%)
+};
+/**
+ * C++ implementation of user space BME280 driver
+ * The device measures continuously (normal mode) at the configured standby
+ * time. The compensation parameters are read once during the setup, and every
+ * read fetches all the measurements with a single burst. As a sensor, the
+ * readings are: temperature (C), pressure (hPa) and relative humidity (%).
+ * REF: https://www.bosch-sensortec.com/media/boschsensortec/downloads/datasheets/bst-bme280-ds002.pdf
+ */
+class BME280: public Sensor, protected I2C {
+public:
+	BME280(unsigned int bus, unsigned int device = 0x76);
+	BME280(const char *path, unsigned int device = 0x76);
+	BME280(I2CBus *bus, unsigned int device = 0x76);
+	~BME280();
+	/*
+	 * Sets the interval between the measurements (milliseconds), rounded
+	 * down to the nearest standby time [1-1000 ms] supported by the device.
+	 * The sampling interval of the schema is set to the <interval>. Returns
+	 * the standby time been set.
+	 */
+	unsigned int setInterval(unsigned int interval);
+	/*
+	 * Reads the latest measurements into <environment>. Returns false if no
+	 * measurement is available yet.
+	 */
+	bool read(Environment &environment);
+	const SensorSchema& getSchema() const noexcept override;
+	bool sample(double *values) override;
+private:
+	void setup();
+	//Loads the compensation parameters
+	void calibrate();
+	//Compensation formulas (double precision), t_fine is updated
+	double compensateTemperature(int adc) noexcept;
+	double compensatePressure(int adc) const noexcept;
+	double compensateHumidity(int adc) const noexcept;
+private:
+	struct {
+		unsigned short t1;
+		short t2, t3;
+		unsigned short p1;
+		short p2, p3, p4, p5, p6, p7, p8, p9;
+		unsigned char h1;
+		short h2;
+		unsigned char h3;
+		short h4, h5;
+		signed char h6;
+	} calibration;
+	double fine; //Temperature shared with the other compensations
+	SensorSchema schema;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_BME280_H_ */
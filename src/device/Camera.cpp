@@ -44,14 +44,15 @@ Camera::~Camera() {
 }
 
 void Camera::read(unsigned int quality) {
+	capture();
+	encode(quality);
+}
+
+void Camera::capture() {
 	try {
 		open();
 		device.vcap >> frame;
-		if (!frame.empty()) {
-			device.params[0] = cv::IMWRITE_JPEG_QUALITY;
-			device.params[1] = (quality <= 100 ? quality : 100);
-			cv::imencode(".jpg", frame, buffer, device.params);
-		} else {
+		if (frame.empty()) {
 			throw Exception(EX_RESOURCE);
 		}
 	} catch (BaseException &e) {
@@ -63,6 +64,29 @@ void Camera::read(unsigned int quality) {
 	}
 }
 
+void Camera::encode(unsigned int quality) {
+	encode(frame, quality);
+}
+
+void Camera::encode(const cv::Mat &image, unsigned int quality) {
+	if (image.empty()) {
+		return;
+	}
+
+	try {
+		device.params[0] = cv::IMWRITE_JPEG_QUALITY;
+		device.params[1] = (quality <= 100 ? quality : 100);
+		cv::imencode(".jpg", image, buffer, device.params);
+		size = image.size();
+	} catch (...) {
+		throw Exception(EX_RESOURCE);
+	}
+}
+
+const cv::Mat& Camera::getImage() const noexcept {
+	return frame;
+}
+
 unsigned const char* Camera::getFrame(unsigned int &bytes) const noexcept {
 	if (device.vcap.isOpened() && buffer.size()) {
 		bytes = buffer.size();
@@ -97,7 +121,7 @@ void Camera::setResolution(unsigned int width, unsigned int height) {
 
 unsigned int Camera::getWidth() const noexcept {
 	if (device.vcap.isOpened()) {
-		return device.width;
+		return size.width;
 	} else {
 		return 0;
 	}
@@ -105,7 +129,7 @@ unsigned int Camera::getWidth() const noexcept {
 
 unsigned int Camera::getHeight() const noexcept {
 	if (device.vcap.isOpened()) {
-		return device.height;
+		return size.height;
 	} else {
 		return 0;
 	}
@@ -35,6 +35,10 @@ public:
 	virtual ~Camera();
 
 	void read(unsigned int quality);
+	void capture();
+	void encode(unsigned int quality);
+	void encode(const cv::Mat &image, unsigned int quality);
+	const cv::Mat& getImage() const noexcept;
 	unsigned const char* getFrame(unsigned int &bytes) const noexcept;
 	void setResolution(unsigned int width, unsigned int height);
 	unsigned int getWidth() const noexcept;
@@ -56,6 +60,7 @@ private:
 
 	cv::Mat frame;
 	std::vector<uchar> buffer;
+	cv::Size size; //Of the encoded image
 };
 
 } /* namespace wanhive */
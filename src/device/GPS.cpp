@@ -22,6 +22,7 @@
 
 #include "GPS.h"
 #include <cmath>
+#include <cstdio>
 #include <cstring>
 
 #if GPSD_API_MAJOR_VERSION < 10
@@ -32,6 +33,17 @@ namespace wanhive {
 
 GPS::GPS() noexcept :
 		connected(false) {
+	memset(&socket, 0, sizeof(socket));
+}
+
+GPS::GPS(const char *host, const char *port) noexcept :
+		GPS() {
+	if (host && host[0]) {
+		snprintf(socket.host, sizeof(socket.host), "%s", host);
+		snprintf(socket.port, sizeof(socket.port), "%s",
+				(port && port[0]) ? port : DEFAULT_GPSD_PORT);
+		socket.enabled = true;
+	}
 }
 
 GPS::~GPS() {
@@ -48,7 +60,19 @@ bool GPS::read(GeoLocation &location) noexcept {
 		return false;
 	} else if (nRead == 0) {
 		return false;
-	} else if (hasData()) {
+	}
+
+	//Consume the buffered reports, the latest state is retained
+	for (unsigned int i = 1; socket.enabled && i < MAX_REPORTS; ++i) {
+		if (!gps_waiting(&data, 0)) {
+			break;
+		} else if (gps_read(&data, message, sizeof(message)) == -1) {
+			disconnect();
+			return false;
+		}
+	}
+
+	if (hasData()) {
 		getData(location);
 		return true;
 	} else {
@@ -60,6 +84,18 @@ void GPS::reset() noexcept {
 	disconnect();
 }
 
+int GPS::getDescriptor() noexcept {
+	if (!socket.enabled || (!connected && !connect())) {
+		return -1;
+	} else {
+		return data.gps_fd;
+	}
+}
+
+bool GPS::isEventDriven() const noexcept {
+	return socket.enabled;
+}
+
 void GPS::getData(GeoLocation &location) const noexcept {
 	memset(&location, 0, sizeof(location));
 	const auto &fix = data.fix;
@@ -96,7 +132,18 @@ bool GPS::isConnected() noexcept {
 
 bool GPS::connect() noexcept {
 	disconnect();
-	if (gps_open(GPSD_SHARED_MEMORY, nullptr, &data) == -1) {
+	if (socket.enabled) {
+		if (gps_open(socket.host, socket.port, &data) == -1) {
+			return false;
+		} else if (gps_stream(&data, WATCH_ENABLE | WATCH_JSON, nullptr)
+				== -1) {
+			gps_close(&data);
+			return false;
+		} else {
+			connected = true;
+			return true;
+		}
+	} else if (gps_open(GPSD_SHARED_MEMORY, nullptr, &data) == -1) {
 		return false;
 	} else {
 		gps_stream(&data, WATCH_ENABLE, nullptr);
@@ -22,44 +22,59 @@
 
 #ifndef DEVICE_GPS_H_
 #define DEVICE_GPS_H_
+#include "GeoSource.h"
 #include <gps.h>
 
 namespace wanhive {
-struct GeoLocation {
-	unsigned int mode; //2D lock (2); 3D Lock (3)
-	double timestamp; //Unix timestamp
-	double latitude; //Latitude
-	double longitude; //Longitude
-	double altitude; //Altitude over mean sea level (meter)
-	double speed; //Speed (meter/second)
-	double heading; //Heading wrt true North
-	double climb; //Climb (meter/second)
-};
 /**
  * GPS driver (uses libgps and gpsd)
+ * Reads the gpsd service's shared memory segment, or connects to the gpsd
+ * service and streams the reports over a socket (JSON protocol).
  */
-class GPS {
+class GPS: public GeoSource {
 public:
+	//Reads the shared memory segment
 	GPS() noexcept;
+	//Connects to the gpsd service at <host>:<port> (default port if nullptr)
+	GPS(const char *host, const char *port = nullptr) noexcept;
 	virtual ~GPS();
 
 	/*
-	 * Reads data from the gpsd service into the <location> structure.
-	 * Returns true on success, false otherwise.
+	 * Reads data from the gpsd service into the <location> structure. In the
+	 * socket mode all the buffered reports are consumed. Returns true on
+	 * success, false otherwise.
 	 */
-	bool read(GeoLocation &location) noexcept;
+	bool read(GeoLocation &location) noexcept override;
 	/*
 	 * Resets the object (disconnects from the gpsd service).
 	 */
-	void reset() noexcept;
+	void reset() noexcept override;
+	/*
+	 * Returns the socket descriptor (connects to the gpsd service if required)
+	 * which becomes readable on the arrival of new reports. Returns -1 in the
+	 * shared memory mode and on connection failure.
+	 */
+	int getDescriptor() noexcept override;
+	/*
+	 * Returns true if the reports are streamed over a socket
+	 */
+	bool isEventDriven() const noexcept override;
 private:
 	void getData(GeoLocation &location) const noexcept;
 	bool hasData() noexcept;
 	bool isConnected() noexcept;
 	bool connect() noexcept;
 	void disconnect() noexcept;
+public:
+	//Maximum number of reports consumed by a single read
+	static constexpr unsigned int MAX_REPORTS = 64;
 private:
 	bool connected;
+	struct {
+		char host[256];
+		char port[16];
+		bool enabled; //Socket mode
+	} socket;
 	gps_data_t data;
 	char message[8192];
 };
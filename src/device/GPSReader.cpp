@@ -0,0 +1,123 @@
+/*
+ * GPSReader.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "GPSReader.h"
+#include <wanhive/wanhive-base.h>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace wanhive {
+
+GPSReader::GPSReader(GeoSource *source, unsigned int interval) :
+		source(source), events(-1), running(true) {
+	if (!source) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	this->interval = Twiddler::min(Twiddler::max(interval, MIN_INTERVAL),
+			MAX_INTERVAL);
+	if ((events = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) == -1) {
+		delete source;
+		throw SystemException();
+	}
+
+	try {
+		worker = std::thread(&GPSReader::work, this);
+	} catch (...) {
+		close(events);
+		delete source;
+		throw Exception(EX_RESOURCE);
+	}
+}
+
+GPSReader::~GPSReader() {
+	stop();
+	close(events);
+	delete source;
+}
+
+unsigned long long GPSReader::read(GeoLocation &location) const noexcept {
+	return fix.load(location);
+}
+
+void GPSReader::work() noexcept {
+	GeoLocation location;
+	double timestamp = 0;
+	while (running) {
+		auto descriptor = -1;
+		auto timeout = (int) interval;
+		if (source->isEventDriven()) {
+			//Sleep until the reports arrive, retry the failed connections
+			descriptor = source->getDescriptor();
+			timeout = (descriptor != -1) ? -1 : RETRY_INTERVAL;
+		}
+
+		auto status = wait(descriptor, timeout);
+		if (status == -1) {
+			break;
+		} else if (status == 0 && source->isEventDriven()) {
+			continue;
+		}
+
+		//Publish only the new fixes
+		if (source->read(location) && location.timestamp != timestamp) {
+			timestamp = location.timestamp;
+			fix.store(location);
+		}
+	}
+}
+
+int GPSReader::wait(int descriptor, int timeout) noexcept {
+	pollfd fds[2];
+	fds[0].fd = events;
+	fds[0].events = POLLIN;
+	fds[0].revents = 0;
+	fds[1].fd = descriptor;
+	fds[1].events = POLLIN;
+	fds[1].revents = 0;
+	auto count = poll(fds, (descriptor != -1 ? 2 : 1), timeout);
+	if (!running) {
+		return -1;
+	} else if (count == -1 && errno != EINTR) {
+		WH_LOG_WARNING("GPS: %s", strerror(errno));
+		return 0;
+	} else {
+		return (fds[1].revents ? 1 : 0);
+	}
+}
+
+void GPSReader::stop() noexcept {
+	running = false;
+	uint64_t value = 1;
+	if (write(events, &value, sizeof(value)) == -1) {
+		WH_LOG_WARNING("GPS: wake up failed");
+	}
+
+	if (worker.joinable()) {
+		worker.join();
+	}
+}
+
+} /* namespace wanhive */
@@ -0,0 +1,78 @@
+/*
+ * GPSReader.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_GPSREADER_H_
+#define DEVICE_GPSREADER_H_
+#include "GeoSource.h"
+#include "../util/Seqlock.h"
+#include <atomic>
+#include <thread>
+
+namespace wanhive {
+/**
+ * Reads the GPS from a dedicated thread
+ * The connection to the source (e.g. the gpsd service) is kept open (and
+ * reestablished on failure) independently of the consumers, and the latest
+ * fix is published through a sequence lock: reading it is lock free and makes
+ * no system call. The thread sleeps until an event driven source signals new
+ * data, other sources are polled at a fixed interval.
+ */
+class GPSReader {
+public:
+	/*
+	 * Takes ownership of the <source> and starts the reader thread. A source
+	 * which isn't event driven is polled every <interval> milliseconds.
+	 */
+	GPSReader(GeoSource *source, unsigned int interval);
+	~GPSReader();
+	/*
+	 * Copies the latest fix into the <location>. Returns the fix's version,
+	 * incremented on every new fix (0: no fix yet).
+	 */
+	unsigned long long read(GeoLocation &location) const noexcept;
+private:
+	void work() noexcept;
+	/*
+	 * Waits for the reports on the <descriptor> (-1: none) for at most the
+	 * <timeout> milliseconds (-1: indefinitely). Returns 1 if the reports have
+	 * arrived, 0 otherwise, and -1 on stop.
+	 */
+	int wait(int descriptor, int timeout) noexcept;
+	void stop() noexcept;
+public:
+	static constexpr unsigned int MIN_INTERVAL = 10;
+	static constexpr unsigned int MAX_INTERVAL = 1000;
+	//Delay between the connection attempts (milliseconds, event driven mode)
+	static constexpr unsigned int RETRY_INTERVAL = 2000;
+private:
+	GeoSource *source;
+	unsigned int interval;
+	Seqlock<GeoLocation> fix;
+
+	int events; //Wakes up the reader thread (eventfd)
+	std::thread worker;
+	std::atomic<bool> running;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_GPSREADER_H_ */
@@ -0,0 +1,312 @@
+/*
+ * GPSReplay.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "GPSReplay.h"
+#include <wanhive/wanhive-base.h>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+namespace {
+
+constexpr double KNOTS = 0.514444; //Meters per second
+constexpr unsigned int MAX_FIELDS = 24;
+
+//Parses a UTC date and time into the Unix time
+double unixTime(int year, int month, int day, int hour, int minute,
+		double second) noexcept {
+	tm t;
+	memset(&t, 0, sizeof(t));
+	t.tm_year = year - 1900;
+	t.tm_mon = month - 1;
+	t.tm_mday = day;
+	t.tm_hour = hour;
+	t.tm_min = minute;
+	return timegm(&t) + second;
+}
+
+//Converts the NMEA's (d)ddmm.mmmm and hemisphere into degrees
+double degrees(const char *value, const char *hemisphere) noexcept {
+	auto raw = strtod(value, nullptr);
+	auto whole = (int) (raw / 100);
+	auto result = whole + (raw - whole * 100) / 60;
+	return (*hemisphere == 'S' || *hemisphere == 'W') ? -result : result;
+}
+
+//Verifies the NMEA checksum (if present) and strips it
+bool checksum(char *line) noexcept {
+	auto star = strchr(line, '*');
+	if (!star) {
+		return true;
+	}
+
+	unsigned char sum = 0;
+	for (auto p = line + 1; p < star; ++p) {
+		sum ^= (unsigned char) *p;
+	}
+	*star = '\0';
+	return sum == strtoul(star + 1, nullptr, 16);
+}
+
+//Finds the numeric JSON member <key>
+bool member(const char *line, const char *key, double &value) noexcept {
+	char pattern[32];
+	snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+	auto p = strstr(line, pattern);
+	if (!p) {
+		return false;
+	}
+
+	char *end = nullptr;
+	p += strlen(pattern);
+	value = strtod(p, &end);
+	return end != p;
+}
+
+}  // namespace
+
+namespace wanhive {
+
+GPSReplay::GPSReplay(const char *path, unsigned int speed) noexcept :
+		speed(speed), file(nullptr), hasPending(false) {
+	snprintf(this->path, sizeof(this->path), "%s", (path ? path : ""));
+	memset(&pending, 0, sizeof(pending));
+	memset(&timeline, 0, sizeof(timeline));
+	memset(&nmea, 0, sizeof(nmea));
+}
+
+GPSReplay::~GPSReplay() {
+	reset();
+}
+
+bool GPSReplay::read(GeoLocation &location) noexcept {
+	if (!open()) {
+		return false;
+	} else if (!speed) {
+		return next(location);
+	}
+
+	//Deliver the latest fix which is due
+	bool found = false;
+	auto current = now();
+	while (hasPending || (hasPending = next(pending))) {
+		if (!timeline.started) {
+			timeline.origin = pending.timestamp;
+			timeline.start = current;
+			timeline.started = true;
+		}
+
+		auto due = timeline.start
+				+ (pending.timestamp - timeline.origin) / speed;
+		if (due > current) {
+			break;
+		}
+
+		location = pending;
+		location.timestamp = due;
+		hasPending = false;
+		found = true;
+	}
+	return found;
+}
+
+void GPSReplay::reset() noexcept {
+	if (file) {
+		fclose(file);
+	}
+	file = nullptr;
+	hasPending = false;
+	memset(&timeline, 0, sizeof(timeline));
+	memset(&nmea, 0, sizeof(nmea));
+}
+
+int GPSReplay::getDescriptor() noexcept {
+	return -1;
+}
+
+bool GPSReplay::isEventDriven() const noexcept {
+	return false;
+}
+
+bool GPSReplay::open() noexcept {
+	if (file) {
+		return true;
+	} else if ((file = fopen(path, "r"))) {
+		timeline.rewound = true;
+		return true;
+	} else {
+		return false;
+	}
+}
+
+bool GPSReplay::next(GeoLocation &location) noexcept {
+	char line[MAX_LINE];
+	bool empty = true; //Reached the end without a fix
+	while (true) {
+		if (!fgets(line, sizeof(line), file)) {
+			if (timeline.rewound && empty) {
+				return false; //No fixes in the capture
+			}
+
+			//Loop, the timeline continues one second after the last fix
+			rewind(file);
+			timeline.offset += (timeline.last - timeline.first) + 1;
+			timeline.rewound = true;
+			empty = true;
+			continue;
+		}
+
+		if (!parse(line, location)) {
+			continue;
+		}
+
+		empty = false;
+		if (timeline.rewound) {
+			timeline.first = location.timestamp;
+			timeline.rewound = false;
+		}
+		timeline.last = location.timestamp;
+		location.timestamp += timeline.offset;
+		return true;
+	}
+}
+
+bool GPSReplay::parse(char *line, GeoLocation &location) noexcept {
+	line[strcspn(line, "\r\n")] = '\0';
+	if (line[0] == '$') {
+		return parseNMEA(line, location);
+	} else if (line[0] == '{') {
+		return parseJSON(line, location);
+	} else {
+		return false;
+	}
+}
+
+bool GPSReplay::parseNMEA(char *line, GeoLocation &location) noexcept {
+	if (!checksum(line)) {
+		return false;
+	}
+
+	//Split in place, the empty fields are preserved
+	const char *fields[MAX_FIELDS];
+	unsigned int count = 0;
+	for (char *p = line; count < MAX_FIELDS;) {
+		fields[count++] = p;
+		p = strchr(p, ',');
+		if (!p) {
+			break;
+		}
+		*p++ = '\0';
+	}
+
+	auto length = strlen(fields[0]);
+	if (length < 6) {
+		return false;
+	}
+
+	auto type = fields[0] + length - 3;
+	if (!strcmp(type, "GGA") && count > 9) {
+		nmea.quality = atoi(fields[6]);
+		nmea.hasAltitude = (fields[9][0] != '\0');
+		nmea.altitude = atof(fields[9]);
+		return false;
+	} else if (!strcmp(type, "GSA") && count > 2) {
+		nmea.mode = atoi(fields[2]);
+		return false;
+	} else if (strcmp(type, "RMC") || count < 10 || fields[2][0] != 'A') {
+		return false;
+	}
+
+	//RMC completes the epoch
+	int hour, minute, day, month, year;
+	double second;
+	if (sscanf(fields[1], "%2d%2d%lf", &hour, &minute, &second) != 3
+			|| sscanf(fields[9], "%2d%2d%2d", &day, &month, &year) != 3) {
+		return false;
+	}
+
+	memset(&location, 0, sizeof(location));
+	if (nmea.mode) {
+		location.mode = nmea.mode;
+	} else {
+		location.mode = nmea.hasAltitude ? 3 : 2;
+	}
+
+	if (location.mode != 2 && location.mode != 3) {
+		return false;
+	}
+
+	//Two-digit year: 1980-2079
+	year += (year < 80) ? 2000 : 1900;
+	location.timestamp = unixTime(year, month, day, hour, minute, second);
+	location.latitude = degrees(fields[3], fields[4]);
+	location.longitude = degrees(fields[5], fields[6]);
+	location.altitude = nmea.hasAltitude ? nmea.altitude : 0;
+	location.speed = atof(fields[7]) * KNOTS;
+	location.heading = atof(fields[8]);
+	return true;
+}
+
+bool GPSReplay::parseJSON(const char *line, GeoLocation &location) noexcept {
+	if (!strstr(line, "\"class\":\"TPV\"")) {
+		return false;
+	}
+
+	double value = 0;
+	memset(&location, 0, sizeof(location));
+	if (!member(line, "mode", value) || (value != 2 && value != 3)) {
+		return false;
+	}
+	location.mode = value;
+
+	//ISO 8601 time (UTC)
+	auto stamp = strstr(line, "\"time\":\"");
+	int year, month, day, hour, minute;
+	double second;
+	if (!stamp
+			|| sscanf(stamp + 8, "%d-%d-%dT%d:%d:%lf", &year, &month, &day,
+					&hour, &minute, &second) != 6) {
+		return false;
+	}
+	location.timestamp = unixTime(year, month, day, hour, minute, second);
+
+	if (!member(line, "lat", location.latitude)
+			|| !member(line, "lon", location.longitude)) {
+		return false;
+	}
+
+	if (!member(line, "altMSL", location.altitude)) {
+		member(line, "alt", location.altitude);
+	}
+	member(line, "speed", location.speed);
+	member(line, "track", location.heading);
+	member(line, "climb", location.climb);
+	return true;
+}
+
+double GPSReplay::now() noexcept {
+	timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+} /* namespace wanhive */
@@ -0,0 +1,90 @@
+/*
+ * GPSReplay.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_GPSREPLAY_H_
+#define DEVICE_GPSREPLAY_H_
+#include "GeoSource.h"
+#include <cstdio>
+
+namespace wanhive {
+/**
+ * Replays a GPS capture file in a loop
+ * The capture holds NMEA sentences (RMC, GGA and GSA) or gpsd's JSON reports
+ * (TPV), one per line. The fixes are paced at <speed> times the recorded rate
+ * and their timestamps are shifted (and compressed) to the replay time, hence
+ * the replay looks like a live receiver. A zero <speed> replays one fix per
+ * read with the recorded timestamps (as fast as the reads).
+ */
+class GPSReplay: public GeoSource {
+public:
+	GPSReplay(const char *path, unsigned int speed = 1) noexcept;
+	~GPSReplay();
+
+	bool read(GeoLocation &location) noexcept override;
+	void reset() noexcept override;
+	//Always -1 (the replay is polled)
+	int getDescriptor() noexcept override;
+	//Always false
+	bool isEventDriven() const noexcept override;
+private:
+	//Opens the capture file if required
+	bool open() noexcept;
+	//Reads the next fix from the capture, rewinds at the end
+	bool next(GeoLocation &location) noexcept;
+	//Parses a line of the capture, returns true if a fix was completed
+	bool parse(char *line, GeoLocation &location) noexcept;
+	bool parseNMEA(char *line, GeoLocation &location) noexcept;
+	bool parseJSON(const char *line, GeoLocation &location) noexcept;
+	//Returns the current Unix time
+	static double now() noexcept;
+public:
+	static constexpr unsigned int MAX_LINE = 1024;
+private:
+	char path[4096];
+	unsigned int speed;
+	FILE *file;
+	GeoLocation pending; //Next fix (read ahead)
+	bool hasPending;
+
+	//Replay timeline: the recorded <origin> is replayed at the wall <start>
+	struct {
+		double origin;
+		double start;
+		double offset; //Added to the recorded time (previous loops)
+		double first; //Recorded time of the capture's first fix
+		double last; //Recorded time of the last fix
+		bool started; //The timeline has been set up
+		bool rewound; //The first fix of the current loop hasn't been read
+	} timeline;
+
+	//NMEA sentences of the current epoch
+	struct {
+		double altitude;
+		unsigned int mode; //From GSA (0: unknown)
+		unsigned int quality; //From GGA
+		bool hasAltitude;
+	} nmea;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_GPSREPLAY_H_ */
@@ -0,0 +1,66 @@
+/*
+ * GeoSource.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_GEOSOURCE_H_
+#define DEVICE_GEOSOURCE_H_
+
+namespace wanhive {
+struct GeoLocation {
+	unsigned int mode; //2D lock (2); 3D Lock (3)
+	double timestamp; //Unix timestamp
+	double latitude; //Latitude
+	double longitude; //Longitude
+	double altitude; //Altitude over mean sea level (meter)
+	double speed; //Speed (meter/second)
+	double heading; //Heading wrt true North
+	double climb; //Climb (meter/second)
+};
+/**
+ * Source of the GPS fixes interface
+ */
+class GeoSource {
+public:
+	virtual ~GeoSource() = default;
+	/*
+	 * Reads the latest fix into the <location> structure. Returns true on
+	 * success, false otherwise.
+	 */
+	virtual bool read(GeoLocation &location) noexcept = 0;
+	/*
+	 * Releases the resources, the next read starts over.
+	 */
+	virtual void reset() noexcept = 0;
+	/*
+	 * Returns the descriptor which becomes readable on the arrival of new
+	 * data, -1 if the source must be polled or has failed.
+	 */
+	virtual int getDescriptor() noexcept = 0;
+	/*
+	 * Returns true if the source signals the new data through its descriptor
+	 * (otherwise it must be polled).
+	 */
+	virtual bool isEventDriven() const noexcept = 0;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_GEOSOURCE_H_ */
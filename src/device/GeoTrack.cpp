@@ -0,0 +1,124 @@
+/*
+ * GeoTrack.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "GeoTrack.h"
+#include <cmath>
+
+namespace {
+
+//Linear interpolation
+double lerp(double a, double b, double f) noexcept {
+	return a + (b - a) * f;
+}
+
+//Interpolation of the angles in degrees along the shorter arc
+double slerp(double a, double b, double f, double range) noexcept {
+	auto delta = std::remainder(b - a, range);
+	auto value = std::fmod(a + delta * f, range);
+	return (value < 0) ? (value + range) : value;
+}
+
+}  // namespace
+
+namespace wanhive {
+
+GeoTrack::GeoTrack() noexcept {
+	clear();
+}
+
+GeoTrack::~GeoTrack() {
+
+}
+
+bool GeoTrack::add(const GeoLocation &location) noexcept {
+	if (location.mode != 2 && location.mode != 3) {
+		return false;
+	} else if (count && location.timestamp <= get(count - 1).timestamp) {
+		return false;
+	}
+
+	if (count == CAPACITY) {
+		fixes[head] = location;
+		head = (head + 1) % CAPACITY;
+	} else {
+		fixes[(head + count) % CAPACITY] = location;
+		++count;
+	}
+	return true;
+}
+
+bool GeoTrack::locate(double timestamp, GeoLocation &location) const noexcept {
+	if (!count || timestamp < get(0).timestamp) {
+		return false;
+	}
+
+	const auto &latest = get(count - 1);
+	if (timestamp >= latest.timestamp) {
+		if (timestamp - latest.timestamp > MAX_EXTRAPOLATION) {
+			return false;
+		} else if (count == 1) {
+			location = latest;
+			location.timestamp = timestamp;
+		} else {
+			interpolate(get(count - 2), latest, timestamp, location);
+		}
+		return true;
+	}
+
+	//The frames are usually newer than most of the fixes
+	unsigned int i = count - 1;
+	while (get(i - 1).timestamp > timestamp) {
+		--i;
+	}
+	interpolate(get(i - 1), get(i), timestamp, location);
+	return true;
+}
+
+unsigned int GeoTrack::size() const noexcept {
+	return count;
+}
+
+void GeoTrack::clear() noexcept {
+	head = 0;
+	count = 0;
+}
+
+const GeoLocation& GeoTrack::get(unsigned int index) const noexcept {
+	return fixes[(head + index) % CAPACITY];
+}
+
+void GeoTrack::interpolate(const GeoLocation &a, const GeoLocation &b,
+		double timestamp, GeoLocation &location) noexcept {
+	auto f = (timestamp - a.timestamp) / (b.timestamp - a.timestamp);
+	location.mode = (a.mode < b.mode) ? a.mode : b.mode;
+	location.timestamp = timestamp;
+	location.latitude = lerp(a.latitude, b.latitude, f);
+	//Longitude wraps around at the antimeridian
+	location.longitude = slerp(a.longitude + 180, b.longitude + 180, f, 360)
+			- 180;
+	location.altitude = lerp(a.altitude, b.altitude, f);
+	location.speed = lerp(a.speed, b.speed, f);
+	location.heading = slerp(a.heading, b.heading, f, 360);
+	location.climb = lerp(a.climb, b.climb, f);
+}
+
+} /* namespace wanhive */
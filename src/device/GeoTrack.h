@@ -0,0 +1,74 @@
+/*
+ * GeoTrack.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_GEOTRACK_H_
+#define DEVICE_GEOTRACK_H_
+#include "GeoSource.h"
+
+namespace wanhive {
+/**
+ * Ring buffer of the recent GPS fixes
+ * Locates the position at an arbitrary time by interpolating between the
+ * surrounding fixes (heading along the shorter arc). The fixes lag behind the
+ * frames, hence a short extrapolation past the latest fix is permitted.
+ */
+class GeoTrack {
+public:
+	GeoTrack() noexcept;
+	~GeoTrack();
+	/*
+	 * Appends a fix (2D or 3D), the fixes older than the latest are ignored.
+	 * Returns true if the fix was added.
+	 */
+	bool add(const GeoLocation &location) noexcept;
+	/*
+	 * Locates the position at the Unix <timestamp>. Returns true on success,
+	 * false if the <timestamp> is outside the track.
+	 */
+	bool locate(double timestamp, GeoLocation &location) const noexcept;
+	/*
+	 * Returns the number of fixes in the track
+	 */
+	unsigned int size() const noexcept;
+	/*
+	 * Removes all the fixes
+	 */
+	void clear() noexcept;
+private:
+	//Returns the <index>th fix from the oldest
+	const GeoLocation& get(unsigned int index) const noexcept;
+	//Interpolates between <a> and <b> at the Unix <timestamp>
+	static void interpolate(const GeoLocation &a, const GeoLocation &b,
+			double timestamp, GeoLocation &location) noexcept;
+public:
+	static constexpr unsigned int CAPACITY = 64;
+	//Maximum extrapolation past the latest fix (seconds)
+	static constexpr double MAX_EXTRAPOLATION = 1.0;
+private:
+	GeoLocation fixes[CAPACITY];
+	unsigned int head; //Position of the oldest fix
+	unsigned int count;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_GEOTRACK_H_ */
@@ -21,62 +21,96 @@
  */
 
 #include "Gimbal.h"
-
-#ifndef WH_GIMBAL_ADAPTER
-#define WH_GIMBAL_ADAPTER 1
-#endif
-
-#ifndef WH_GIMBAL_DEVICE
-#define WH_GIMBAL_DEVICE 0x40
-#endif
+#include <wanhive/wanhive-base.h>
 
 namespace wanhive {
 
 Gimbal::Gimbal() :
-		Servo(WH_GIMBAL_ADAPTER, WH_GIMBAL_DEVICE) {
+		servo(new Servo(ADAPTER, DEVICE)), owner(true), pins(PINS) {
 }
 
-Gimbal::~Gimbal() {
+Gimbal::Gimbal(I2CBus *bus) :
+		servo(new Servo(bus, DEVICE)), owner(true), pins(PINS) {
+}
 
+Gimbal::Gimbal(Servo *servo, const Pins &pins) :
+		servo(servo), owner(false), pins(pins) {
+	if (!servo || pins.pan >= Servo::CHANNELS || pins.roll >= Servo::CHANNELS
+			|| pins.tilt >= Servo::CHANNELS || pins.pan == pins.roll
+			|| pins.pan == pins.tilt || pins.roll == pins.tilt) {
+		throw Exception(EX_PARAMETER);
+	}
 }
 
-unsigned int Gimbal::getPan() const noexcept {
+Gimbal::~Gimbal() {
+	if (owner) {
+		delete servo;
+	}
+}
+
+float Gimbal::getPan() const noexcept {
 	return pan;
 }
 
-void Gimbal::setPan(unsigned int pan) {
-	if (this->pan != pan && pan <= PAN_MAX) {
-		sendPulse(0, (((float) pan) / 90) + 0.5);
-		this->pan = pan;
-	}
+void Gimbal::setPan(float pan) {
+	move(pan, roll, tilt);
 }
 
-unsigned int Gimbal::getRoll() const noexcept {
+float Gimbal::getRoll() const noexcept {
 	return roll;
 }
 
-void Gimbal::setRoll(unsigned int roll) {
-	if (this->roll != roll && roll <= ROLL_MAX) {
-		sendPulse(2, (((float) roll) / 90) + 0.5);
-		this->roll = roll;
-	}
+void Gimbal::setRoll(float roll) {
+	move(pan, roll, tilt);
 }
 
-unsigned int Gimbal::getTilt() const noexcept {
+float Gimbal::getTilt() const noexcept {
 	return tilt;
 }
 
-void Gimbal::setTilt(unsigned int tilt) {
-	if (this->tilt != tilt && tilt <= TILT_MAX) {
-		sendPulse(4, (((float) tilt) / 90) + 0.5);
-		this->tilt = tilt;
-	}
+void Gimbal::setTilt(float tilt) {
+	move(pan, roll, tilt);
+}
+
+void Gimbal::setPanTilt(float pan, float tilt) {
+	move(pan, roll, tilt);
 }
 
 void Gimbal::reset() {
-	setPan(90);
-	setRoll(90);
-	setTilt(90);
+	move(90, 90, 90);
+}
+
+void Gimbal::move(float pan, float roll, float tilt) {
+	unsigned int channels[3];
+	float pulses[3];
+	unsigned int count = 0;
+	if (this->pan != pan && pan >= PAN_MIN && pan <= PAN_MAX) {
+		channels[count] = pins.pan;
+		pulses[count++] = (pan / 90) + 0.5f;
+	} else {
+		pan = this->pan;
+	}
+
+	if (this->roll != roll && roll >= ROLL_MIN && roll <= ROLL_MAX) {
+		channels[count] = pins.roll;
+		pulses[count++] = (roll / 90) + 0.5f;
+	} else {
+		roll = this->roll;
+	}
+
+	if (this->tilt != tilt && tilt >= TILT_MIN && tilt <= TILT_MAX) {
+		channels[count] = pins.tilt;
+		pulses[count++] = (tilt / 90) + 0.5f;
+	} else {
+		tilt = this->tilt;
+	}
+
+	if (count) {
+		servo->sendPulses(channels, pulses, count);
+		this->pan = pan;
+		this->roll = roll;
+		this->tilt = tilt;
+	}
 }
 
 } /* namespace wanhive */
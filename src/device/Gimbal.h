@@ -25,27 +25,57 @@
 
 #include "Servo.h"
 
+#ifndef WH_GIMBAL_ADAPTER
+#define WH_GIMBAL_ADAPTER 1
+#endif
+
+#ifndef WH_GIMBAL_DEVICE
+#define WH_GIMBAL_DEVICE 0x40
+#endif
+
 namespace wanhive {
 /**
  * 3-axis gimbal implementation
  * Uses standard servo to fix the orientation.
- * PCA9685 pin map: Pan(0), Roll(2), Tilt(4)
+ * Default PCA9685 pin map: Pan(0), Roll(2), Tilt(4)
+ * Multiple gimbals can share a PCA9685 controller.
  */
-class Gimbal: private Servo {
+class Gimbal {
 public:
+	//PCA9685 output channels of the axes
+	struct Pins {
+		unsigned int pan;
+		unsigned int roll;
+		unsigned int tilt;
+	};
+
 	Gimbal();
+	//Uses the PCA9685 attached to the given <bus>
+	Gimbal(I2CBus *bus);
+	//Uses the given <pins> of a shared <servo> controller (not owned)
+	Gimbal(Servo *servo, const Pins &pins);
 	virtual ~Gimbal();
 
-	unsigned int getPan() const noexcept;
-	void setPan(unsigned int pan);
-	unsigned int getRoll() const noexcept;
-	void setRoll(unsigned int roll);
-	unsigned int getTilt() const noexcept;
-	void setTilt(unsigned int tilt);
+	//Angles are in degrees
+	float getPan() const noexcept;
+	void setPan(float pan);
+	float getRoll() const noexcept;
+	void setRoll(float roll);
+	float getTilt() const noexcept;
+	void setTilt(float tilt);
+	//Updates pan and tilt in a single batch
+	void setPanTilt(float pan, float tilt);
 
 	//Centers the gimbal
 	void reset();
+private:
+	//Sends the pulses for the axes which have changed in a single batch
+	void move(float pan, float roll, float tilt);
 public:
+	//I2C adapter number and PCA9685 address
+	static constexpr unsigned int ADAPTER = WH_GIMBAL_ADAPTER;
+	static constexpr unsigned int DEVICE = WH_GIMBAL_DEVICE;
+	static constexpr Pins PINS { 0, 2, 4 }; //Default pin map
 	static constexpr unsigned int PAN_MIN = 0;
 	static constexpr unsigned int PAN_MAX = 180;
 	static constexpr unsigned int ROLL_MIN = 0;
@@ -53,9 +83,12 @@ public:
 	static constexpr unsigned int TILT_MIN = 0;
 	static constexpr unsigned int TILT_MAX = 180;
 private:
-	unsigned int pan { 0 };
-	unsigned int roll { 0 };
-	unsigned int tilt { 0 };
+	Servo *servo;
+	bool owner;
+	Pins pins;
+	float pan { 0 };
+	float roll { 0 };
+	float tilt { 0 };
 };
 
 } /* namespace wanhive */
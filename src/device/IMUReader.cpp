@@ -0,0 +1,162 @@
+/*
+ * IMUReader.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "IMUReader.h"
+#include <wanhive/wanhive-base.h>
+#include <cmath>
+#include <ctime>
+
+namespace {
+
+//Tolerated drift of the sample clock (seconds)
+constexpr double DRIFT = 0.01;
+
+double now() noexcept {
+	timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+}  // namespace
+
+namespace wanhive {
+
+IMUReader::IMUReader(MPU6050 *sensor, unsigned int interval) :
+		sensor(sensor), dropped(0), clock(0), running(true) {
+	if (!sensor) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	this->interval = Twiddler::min(Twiddler::max(interval, MIN_INTERVAL),
+			MAX_INTERVAL);
+	rate = sensor->getRate();
+	try {
+		worker = std::thread(&IMUReader::work, this);
+	} catch (...) {
+		delete sensor;
+		throw Exception(EX_RESOURCE);
+	}
+}
+
+IMUReader::~IMUReader() {
+	stop();
+	delete sensor;
+}
+
+unsigned int IMUReader::read(InertialSample *samples,
+		unsigned int count) noexcept {
+	unsigned int n = 0;
+	while (n < count && this->samples.pop(samples[n])) {
+		++n;
+	}
+	return n;
+}
+
+unsigned int IMUReader::getRate() const noexcept {
+	return rate;
+}
+
+unsigned long long IMUReader::getDropped() const noexcept {
+	return dropped.load(std::memory_order_relaxed);
+}
+
+void IMUReader::work() noexcept {
+	auto period = std::chrono::milliseconds(interval);
+	auto tick = std::chrono::steady_clock::now();
+	bool failing = false;
+	while (next(tick)) {
+		try {
+			while (collect()) {
+				//Drain the backlog
+			}
+			failing = false;
+		} catch (BaseException &e) {
+			//Report the first failure of a series
+			if (!failing) {
+				WH_LOG_EXCEPTION(e);
+			}
+			failing = true;
+		}
+		//Don't try to catch up after an overrun
+		tick = std::max(tick + period, std::chrono::steady_clock::now());
+	}
+}
+
+bool IMUReader::collect() {
+	MPU6050::Sample burst[MPU6050::MAX_BURST];
+	auto overflows = sensor->getOverflows();
+	auto count = sensor->read(burst, MPU6050::MAX_BURST);
+	if (sensor->getOverflows() != overflows) {
+		WH_LOG_DEBUG("IMU: FIFO overflow");
+		clock = 0;
+	}
+
+	if (!count) {
+		return false;
+	}
+
+	/*
+	 * Follow the sample clock. If the FIFO has been drained then the last
+	 * sample was taken just now: realign if the clocks have drifted apart.
+	 */
+	auto period = 1.0 / rate;
+	auto backlog = (count == MPU6050::MAX_BURST);
+	auto last = now();
+	if (!clock
+			|| (!backlog
+					&& fabs(last - (clock + (count - 1) * period))
+							> (2 * period + DRIFT))) {
+		clock = last - (count - 1) * period;
+	}
+
+	InertialSample sample;
+	for (unsigned int i = 0; i < count; ++i) {
+		sample.timestamp = clock;
+		sample.data = burst[i];
+		clock += period;
+		if (!samples.push(sample)) {
+			dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+	return backlog;
+}
+
+bool IMUReader::next(std::chrono::steady_clock::time_point tick) noexcept {
+	std::unique_lock<std::mutex> lock(mutex);
+	condition.wait_until(lock, tick, [this] {
+		return !running;
+	});
+	return running;
+}
+
+void IMUReader::stop() noexcept {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	condition.notify_all();
+	if (worker.joinable()) {
+		worker.join();
+	}
+}
+
+} /* namespace wanhive */
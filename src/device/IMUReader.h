@@ -0,0 +1,97 @@
+/*
+ * IMUReader.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_IMUREADER_H_
+#define DEVICE_IMUREADER_H_
+#include "MPU6050.h"
+#include "../util/RingBuffer.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace wanhive {
+struct InertialSample {
+	double timestamp; //Unix timestamp
+	MPU6050::Sample data;
+};
+/**
+ * Collects the inertial samples from a dedicated thread
+ * The thread drains the sensor's FIFO in bursts at a fixed interval, well
+ * within the FIFO's capacity, and timestamps the samples by the sensor's
+ * sample clock (realigned with the system clock when they drift apart). The
+ * samples are handed over to a single consumer through a lock-free queue;
+ * the samples which don't fit are dropped.
+ */
+class IMUReader {
+public:
+	/*
+	 * Takes ownership of the <sensor> and starts the reader thread. The FIFO
+	 * is drained every <interval> milliseconds.
+	 */
+	IMUReader(MPU6050 *sensor, unsigned int interval);
+	~IMUReader();
+	/*
+	 * Removes at most <count> oldest samples into <samples> (single consumer).
+	 * Returns the number of samples.
+	 */
+	unsigned int read(InertialSample *samples, unsigned int count) noexcept;
+	/*
+	 * Returns the sample rate in Hz
+	 */
+	unsigned int getRate() const noexcept;
+	/*
+	 * Returns the number of samples dropped because the queue was full
+	 */
+	unsigned long long getDropped() const noexcept;
+private:
+	void work() noexcept;
+	//Drains the FIFO, returns false on error
+	bool collect();
+	//Waits until the <tick>, returns false on stop
+	bool next(std::chrono::steady_clock::time_point tick) noexcept;
+	void stop() noexcept;
+public:
+	static constexpr unsigned int MIN_INTERVAL = 1;
+	static constexpr unsigned int MAX_INTERVAL = 50;
+	//Queue capacity (samples)
+	static constexpr unsigned int CAPACITY = 4096;
+private:
+	MPU6050 *sensor;
+	unsigned int interval;
+	unsigned int rate;
+	RingBuffer<InertialSample, CAPACITY> samples;
+	std::atomic<unsigned long long> dropped;
+
+	//Timestamp of the next sample (accessed only by the reader thread)
+	double clock;
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::thread worker;
+	bool running;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_IMUREADER_H_ */
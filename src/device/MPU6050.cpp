@@ -0,0 +1,159 @@
+/*
+ * MPU6050.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "MPU6050.h"
+#include <wanhive/wanhive-base.h>
+
+namespace {
+
+constexpr unsigned char SMPLRT_DIV_REG = 0x19;
+constexpr unsigned char CONFIG_REG = 0x1A;
+constexpr unsigned char GYRO_CONFIG_REG = 0x1B;
+constexpr unsigned char ACCEL_CONFIG_REG = 0x1C;
+constexpr unsigned char FIFO_EN_REG = 0x23;
+constexpr unsigned char INT_ENABLE_REG = 0x38;
+constexpr unsigned char INT_STATUS_REG = 0x3A;
+constexpr unsigned char USER_CTRL_REG = 0x6A;
+constexpr unsigned char PWR_MGMT_1_REG = 0x6B;
+constexpr unsigned char FIFO_COUNTH_REG = 0x72;
+constexpr unsigned char FIFO_R_W_REG = 0x74;
+constexpr unsigned char WHO_AM_I_REG = 0x75;
+
+constexpr unsigned char DEVICE_RESET_MASK = 0x80;
+constexpr unsigned char CLOCK_PLL_XGYRO = 0x01;
+constexpr unsigned char DLPF_184HZ = 0x01; //1 kHz gyroscope output rate
+constexpr unsigned char GYRO_500DPS = 0x08;
+constexpr unsigned char ACCEL_4G = 0x08;
+constexpr unsigned char FIFO_ACCEL_GYRO = 0x78; //XG, YG, ZG and ACCEL
+constexpr unsigned char FIFO_ENABLE_MASK = 0x40;
+constexpr unsigned char FIFO_RESET_MASK = 0x04;
+constexpr unsigned char FIFO_OFLOW_MASK = 0x10;
+
+constexpr unsigned int OUTPUT_RATE = 1000;
+constexpr unsigned int RESET_DELAY = 100; //Milliseconds
+
+short decode(const unsigned char *bytes) noexcept {
+	return (short) ((bytes[0] << 8) | bytes[1]);
+}
+
+}  // namespace
+
+namespace wanhive {
+
+MPU6050::MPU6050(unsigned int bus, unsigned int device) :
+		I2C(bus, device), rate(0), overflows(0) {
+	setup();
+}
+
+MPU6050::MPU6050(const char *path, unsigned int device) :
+		I2C(path, device), rate(0), overflows(0) {
+	setup();
+}
+
+MPU6050::MPU6050(I2CBus *bus, unsigned int device) :
+		I2C(bus, device), rate(0), overflows(0) {
+	setup();
+}
+
+MPU6050::~MPU6050() {
+
+}
+
+unsigned int MPU6050::setRate(unsigned int rate) {
+	rate = Twiddler::min(Twiddler::max(rate, MIN_RATE), MAX_RATE);
+	//Sample rate = gyroscope output rate / (1 + SMPLRT_DIV)
+	auto divider = (OUTPUT_RATE + rate / 2) / rate - 1;
+	I2C::write(SMPLRT_DIV_REG, (unsigned char) divider);
+	this->rate = OUTPUT_RATE / (divider + 1);
+	resetFifo();
+	return this->rate;
+}
+
+unsigned int MPU6050::getRate() const noexcept {
+	return rate;
+}
+
+unsigned int MPU6050::read(Sample *samples, unsigned int count) {
+	//The status and the FIFO level in a single transaction
+	unsigned char status;
+	unsigned char level[2];
+	begin();
+	queueRead(INT_STATUS_REG, 1, &status);
+	queueRead(FIFO_COUNTH_REG, 2, level);
+	commit();
+
+	if (status & FIFO_OFLOW_MASK) {
+		//The samples are no longer aligned
+		++overflows;
+		resetFifo();
+		return 0;
+	}
+
+	auto available = ((level[0] << 8) | level[1]) / SAMPLE_SIZE;
+	count = Twiddler::min(Twiddler::min(count, available), MAX_BURST);
+	if (!count) {
+		return 0;
+	}
+
+	unsigned char buffer[MAX_BURST * SAMPLE_SIZE];
+	begin();
+	queueRead(FIFO_R_W_REG, count * SAMPLE_SIZE, buffer);
+	commit();
+	for (unsigned int i = 0; i < count; ++i) {
+		auto bytes = buffer + i * SAMPLE_SIZE;
+		for (unsigned int j = 0; j < 3; ++j) {
+			samples[i].accel[j] = decode(bytes + 2 * j);
+			samples[i].gyro[j] = decode(bytes + 6 + 2 * j);
+		}
+	}
+	return count;
+}
+
+void MPU6050::resetFifo() {
+	I2C::write(USER_CTRL_REG, FIFO_RESET_MASK);
+	I2C::write(USER_CTRL_REG, FIFO_ENABLE_MASK);
+}
+
+unsigned long long MPU6050::getOverflows() const noexcept {
+	return overflows;
+}
+
+void MPU6050::setup() {
+	auto id = readByte(WHO_AM_I_REG) & 0x7E;
+	if (id != 0x68 && id != 0x70 && id != 0x72) {
+		//Not an MPU-6000/6050/6500/9250 class device
+		throw Exception(EX_RESOURCE);
+	}
+
+	I2C::write(PWR_MGMT_1_REG, DEVICE_RESET_MASK);
+	Timer::sleep(RESET_DELAY);
+	//Wake up, clocked by the gyroscope's PLL
+	I2C::write(PWR_MGMT_1_REG, CLOCK_PLL_XGYRO);
+	I2C::write(CONFIG_REG, DLPF_184HZ);
+	I2C::write(GYRO_CONFIG_REG, GYRO_500DPS);
+	I2C::write(ACCEL_CONFIG_REG, ACCEL_4G);
+	I2C::write(FIFO_EN_REG, FIFO_ACCEL_GYRO);
+	I2C::write(INT_ENABLE_REG, FIFO_OFLOW_MASK);
+	setRate(MAX_RATE);
+}
+
+} /* namespace wanhive */
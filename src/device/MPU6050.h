@@ -0,0 +1,90 @@
+/*
+ * MPU6050.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_MPU6050_H_
+#define DEVICE_MPU6050_H_
+#include "../interface/I2C.h"
+
+namespace wanhive {
+/**
+ * C++ implementation of user space MPU-6050 (MPU-6000 family) driver
+ * The accelerometer and the gyroscope are sampled by the device into its FIFO
+ * at a fixed rate (at most 1 kHz), the samples are collected in bursts.
+ * REF: https://invensense.tdk.com/wp-content/uploads/2015/02/MPU-6000-Register-Map1.pdf
+ */
+class MPU6050: protected I2C {
+public:
+	//Raw measurements (LSB, see the sensitivities below)
+	struct Sample {
+		short accel[3];
+		short gyro[3];
+	};
+
+	MPU6050(unsigned int bus, unsigned int device = 0x68);
+	MPU6050(const char *path, unsigned int device = 0x68);
+	MPU6050(I2CBus *bus, unsigned int device = 0x68);
+	~MPU6050();
+	/*
+	 * Sets the sample rate, capped to range [4, 1000] Hz. The FIFO is reset.
+	 * Returns the sample rate been set.
+	 */
+	unsigned int setRate(unsigned int rate);
+	/*
+	 * Returns the sample rate in Hz
+	 */
+	unsigned int getRate() const noexcept;
+	/*
+	 * Reads at most <count> (at most MAX_BURST) samples from the FIFO in a
+	 * single burst. If the FIFO has overflowed then it's reset and no sample
+	 * is returned. Returns the number of samples read.
+	 */
+	unsigned int read(Sample *samples, unsigned int count);
+	/*
+	 * Discards the contents of the FIFO
+	 */
+	void resetFifo();
+	/*
+	 * Returns the number of FIFO overflows
+	 */
+	unsigned long long getOverflows() const noexcept;
+private:
+	void setup();
+public:
+	//Sensitivities at the configured full scale (+/-4 g, +/-500 degrees/s)
+	static constexpr double ACCEL_SENSITIVITY = 8192; //LSB per g
+	static constexpr double GYRO_SENSITIVITY = 65.5; //LSB per degree/s
+	//Sample rate range: [4-1000 Hz]
+	static constexpr unsigned int MIN_RATE = 4;
+	static constexpr unsigned int MAX_RATE = 1000;
+	//FIFO size and the bytes per sample (accelerometer and gyroscope)
+	static constexpr unsigned int FIFO_SIZE = 1024;
+	static constexpr unsigned int SAMPLE_SIZE = 12;
+	//Maximum number of samples read in a burst
+	static constexpr unsigned int MAX_BURST = FIFO_SIZE / SAMPLE_SIZE;
+private:
+	unsigned int rate;
+	unsigned long long overflows;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_MPU6050_H_ */
@@ -22,10 +22,12 @@
 
 #include "PCA9685.h"
 #include <wanhive/wanhive-base.h>
+#include <cstring>
 
 #define LED0_ON_L 0x6     //First LED
 #define ALL_LED_ON_L 0xFA //All LED
 #define PIN_COUNT 16      //Total number of pins
+#define MAX_GAP 1         //Unchanged pins bridged inside a message
 
 namespace {
 
@@ -56,6 +58,33 @@ unsigned int baseRegister(unsigned int pin) {
 	}
 }
 
+/**
+ * Maps the pin number to the shadow registers (ALL_LED is the last).
+ */
+unsigned int index(unsigned int pin) noexcept {
+	return (pin < PIN_COUNT) ? pin : PIN_COUNT;
+}
+
+/**
+ * Translates the PWM value into LEDX_ON_L, LEDX_ON_H, LEDX_OFF_L, LEDX_OFF_H
+ */
+void encode(unsigned int value, unsigned char *registers) noexcept {
+	unsigned short on = 0;
+	unsigned short off = 0;
+	if (value >= wanhive::PCA9685::PWM_MAX) {
+		on = FULL_MASK << 8; //Full-on
+	} else if (value > 0) {
+		off = value;
+	} else {
+		off = FULL_MASK << 8; //Full-off
+	}
+
+	registers[0] = on & 0xFF;
+	registers[1] = on >> 8;
+	registers[2] = off & 0xFF;
+	registers[3] = off >> 8;
+}
+
 }  // namespace
 
 namespace wanhive {
@@ -70,26 +99,47 @@ PCA9685::PCA9685(const char *path, unsigned int device) :
 	setup();
 }
 
+PCA9685::PCA9685(I2CBus *bus, unsigned int device) :
+		I2C(bus, device) {
+	setup();
+}
+
 PCA9685::~PCA9685() {
 
 }
 
 void PCA9685::pwmWrite(unsigned int pin, unsigned int value) {
-	if (value >= PWM_MAX) {
-		fullOn(pin, true);
-	} else if (value > 0) {
-		write(pin, 0, value);
-	} else {
-		fullOff(pin, true);
+	pwmWrite(&pin, &value, 1);
+}
+
+void PCA9685::pwmWrite(const unsigned int *pins, const unsigned int *values,
+		unsigned int count) {
+	bool changed[PIN_COUNT + 1] = { };
+	unsigned char channels[PIN_COUNT + 1][4];
+	memcpy(channels, shadow.channels, sizeof(channels));
+	unsigned char registers[4];
+	//Individual pins override the ALL_LED setting
+	for (unsigned int i = 0; i < count; ++i) {
+		if (pins[i] >= PIN_COUNT) {
+			encode(values[i], registers);
+			changed[PIN_COUNT] = update(channels, PIN_COUNT, registers)
+					|| changed[PIN_COUNT];
+		}
+	}
+
+	for (unsigned int i = 0; i < count; ++i) {
+		if (pins[i] < PIN_COUNT) {
+			encode(values[i], registers);
+			changed[pins[i]] = update(channels, pins[i], registers)
+					|| changed[pins[i]];
+		}
 	}
+
+	flush(channels, changed);
 }
 
 void PCA9685::digitalWrite(unsigned int pin, bool value) {
-	if (value) {
-		fullOn(pin, true);
-	} else {
-		fullOff(pin, true);
-	}
+	pwmWrite(pin, (value ? PWM_MAX : 0));
 }
 
 unsigned int PCA9685::setFrequency(unsigned int frequency) {
@@ -109,54 +159,43 @@ unsigned int PCA9685::setFrequency(unsigned int frequency) {
 		prescale = PRESCALE_MIN;
 	}
 
-	unsigned char state;
-	I2C::read(MODE1_REG, state);
-	//Clear the restart bit
-	state &= ~RESTART_MASK;
+	if (prescale == shadow.prescale) {
+		return frequency;
+	}
+
 	//Go to sleep (set the sleep bit)
-	state |= SLEEP_MASK;
-	I2C::write(MODE1_REG, state);
+	setMode1(shadow.mode1 | SLEEP_MASK);
 	//Set prescale
 	I2C::write(PRESCALE_REG, prescale);
+	shadow.prescale = prescale;
 	//Wake up (clear the sleep bit)
-	state &= ~SLEEP_MASK;
-	I2C::write(MODE1_REG, state);
+	setMode1(shadow.mode1 & ~SLEEP_MASK);
 	//Allow the oscillator to stabilize
 	Timer::sleep(1);
 	//Restart PWM
-	state |= (RESTART_MASK | AI_MASK);
-	I2C::write(MODE1_REG, state);
+	setMode1(shadow.mode1 | AI_MASK, true);
 
 	return frequency;
 }
 
 void PCA9685::restart() {
-	unsigned char state;
-	I2C::read(MODE1_REG, state);
-	if (state & RESTART_MASK) {
-		state &= ~RESTART_MASK;
-		state &= ~SLEEP_MASK;
-		I2C::write(MODE1_REG, state);
+	if (shadow.mode1 & SLEEP_MASK) {
+		setMode1(shadow.mode1 & ~SLEEP_MASK);
 		Timer::sleep(1);
 	}
 
-	state |= RESTART_MASK;
-	I2C::write(MODE1_REG, state);
+	setMode1(shadow.mode1, true);
 }
 
 void PCA9685::sleep() {
-	unsigned char state;
-	I2C::read(MODE1_REG, state);
-	state |= SLEEP_MASK;
-	I2C::write(MODE1_REG, state);
+	setMode1(shadow.mode1 | SLEEP_MASK);
 }
 
 void PCA9685::wakeUp() {
-	unsigned char state;
-	I2C::read(MODE1_REG, state);
-	state &= ~SLEEP_MASK;
-	I2C::write(MODE1_REG, state);
-	Timer::sleep(1);
+	if (shadow.mode1 & SLEEP_MASK) {
+		setMode1(shadow.mode1 & ~SLEEP_MASK);
+		Timer::sleep(1);
+	}
 }
 
 void PCA9685::write(unsigned int pin, unsigned short on, unsigned short off) {
@@ -164,42 +203,40 @@ void PCA9685::write(unsigned int pin, unsigned short on, unsigned short off) {
 	on &= 0x0FFF;
 	off &= 0x0FFF;
 
-	//Write to on and off registers
-	auto reg = baseRegister(pin);
-	I2C::write(reg, on);      //LEDX_ON
-	I2C::write(reg + 2, off); //LEDX_OFF
+	unsigned char registers[4];
+	registers[0] = on & 0xFF;
+	registers[1] = on >> 8;
+	registers[2] = off & 0xFF;
+	registers[3] = off >> 8;
+	store(pin, registers);
 }
 
 void PCA9685::read(unsigned int pin, unsigned short &on, unsigned short &off) {
-	auto reg = baseRegister(pin);
-	I2C::read(reg, on);
-	I2C::read(reg + 2, off);
+	auto registers = shadow.channels[index(pin)];
+	on = registers[0] | (registers[1] << 8);
+	off = registers[2] | (registers[3] << 8);
 }
 
 void PCA9685::fullOn(unsigned int pin, bool flag) {
-	auto reg = baseRegister(pin) + 1; //LEDX_ON_H
-	unsigned char state;
-	I2C::read(reg, state);
-	state = Twiddler::mask(state, FULL_MASK, flag);
-	I2C::write(reg, state);
-
+	unsigned char registers[4];
+	memcpy(registers, shadow.channels[index(pin)], 4);
+	registers[1] = Twiddler::mask(registers[1], FULL_MASK, flag); //LEDX_ON_H
 	//Because full-off takes precedence
 	if (flag) {
-		fullOff(pin, false);
+		registers[3] &= ~FULL_MASK; //LEDX_OFF_H
 	}
+	store(pin, registers);
 }
 
 void PCA9685::fullOff(unsigned int pin, bool flag) {
-	auto reg = baseRegister(pin) + 3; //LEDX_OFF_H
-	unsigned char state;
-	I2C::read(reg, state);
-	state = Twiddler::mask(state, FULL_MASK, flag);
-	I2C::write(reg, state);
+	unsigned char registers[4];
+	memcpy(registers, shadow.channels[index(pin)], 4);
+	registers[3] = Twiddler::mask(registers[3], FULL_MASK, flag); //LEDX_OFF_H
+	store(pin, registers);
 }
 
 void PCA9685::setOutputMode(bool invert, bool openDrain) {
-	unsigned char state;
-	I2C::read(MODE2_REG, state);
+	auto state = shadow.mode2;
 
 	if (invert) {
 		state |= INVRT_MASK;
@@ -213,15 +250,105 @@ void PCA9685::setOutputMode(bool invert, bool openDrain) {
 		state |= TOTEMPOLE_MASK;
 	}
 
-	I2C::write(MODE2_REG, state);
+	if (state != shadow.mode2) {
+		I2C::write(MODE2_REG, state);
+		shadow.mode2 = state;
+	}
+}
+
+void PCA9685::resync() {
+	unsigned char modes[2];
+	//Relies on register auto-increment
+	I2C::begin();
+	I2C::queueRead(MODE1_REG, sizeof(modes), modes);
+	I2C::queueRead(LED0_ON_L, PIN_COUNT * 4, shadow.channels);
+	I2C::queueRead(ALL_LED_ON_L, 4, shadow.channels[PIN_COUNT]);
+	I2C::queueRead(PRESCALE_REG, 1, &shadow.prescale);
+	I2C::commit();
+	shadow.mode1 = modes[0] & ~RESTART_MASK;
+	shadow.mode2 = modes[1];
 }
 
 void PCA9685::setup() {
+	memset(&shadow, 0, sizeof(shadow));
 	unsigned char state;
 	I2C::read(MODE1_REG, state);
 	//Enable register auto-increment
 	state = (state & ~RESTART_MASK) | AI_MASK;
 	I2C::write(MODE1_REG, state);
+	resync();
+}
+
+void PCA9685::setMode1(unsigned char value, bool restart) {
+	value &= ~RESTART_MASK;
+	if (!restart && value == shadow.mode1) {
+		return;
+	}
+
+	I2C::write(MODE1_REG,
+			(unsigned char) (restart ? (value | RESTART_MASK) : value));
+	shadow.mode1 = value;
+}
+
+bool PCA9685::update(unsigned char channels[][4], unsigned int pin,
+		const unsigned char *registers) noexcept {
+	if (pin < PIN_COUNT) {
+		if (memcmp(channels[pin], registers, 4) == 0) {
+			return false;
+		} else {
+			memcpy(channels[pin], registers, 4);
+			return true;
+		}
+	}
+
+	//ALL_LED overwrites every channel
+	bool changed = false;
+	for (unsigned int i = 0; i <= PIN_COUNT; ++i) {
+		if (memcmp(channels[i], registers, 4)) {
+			memcpy(channels[i], registers, 4);
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+void PCA9685::store(unsigned int pin, const unsigned char *registers) {
+	bool changed[PIN_COUNT + 1] = { };
+	unsigned char channels[PIN_COUNT + 1][4];
+	memcpy(channels, shadow.channels, sizeof(channels));
+	pin = index(pin);
+	changed[pin] = update(channels, pin, registers);
+	flush(channels, changed);
+}
+
+void PCA9685::flush(const unsigned char channels[][4], const bool *changed) {
+	I2C::begin();
+	if (changed[PIN_COUNT]) {
+		I2C::queueWrite(ALL_LED_ON_L, 4, channels[PIN_COUNT]);
+	}
+
+	//Relies on register auto-increment
+	for (unsigned int pin = 0; pin < PIN_COUNT;) {
+		if (!changed[pin]) {
+			++pin;
+			continue;
+		}
+
+		//Bridge the short gaps between changed pins with the shadow registers
+		auto first = pin;
+		auto last = pin;
+		for (++pin; pin < PIN_COUNT && (pin - last) <= (MAX_GAP + 1); ++pin) {
+			if (changed[pin]) {
+				last = pin;
+			}
+		}
+		I2C::queueWrite(baseRegister(first), (last - first + 1) * 4,
+				channels[first]);
+		pin = last + 1;
+	}
+	I2C::commit();
+	//A failed transaction leaves the shadow as it was, a retry rewrites
+	memcpy(shadow.channels, channels, sizeof(shadow.channels));
 }
 
 } /* namespace wanhive */
@@ -27,12 +27,15 @@
 namespace wanhive {
 /**
  * C++ implementation of user space PCA9685 driver
+ * Keeps a shadow copy of the registers, hence the device is read only during
+ * the setup and on explicit resynchronization.
  * REF: http://www.nxp.com/documents/data_sheet/PCA9685.pdf
  */
 class PCA9685: protected I2C {
 public:
 	PCA9685(unsigned int bus, unsigned int device = 0x40);
 	PCA9685(const char *path, unsigned int device = 0x40);
+	PCA9685(I2CBus *bus, unsigned int device = 0x40);
 	~PCA9685();
 	/*
 	 * Simple PWM control which sets on-tick to 0 and off-tick to value.
@@ -41,6 +44,14 @@ public:
 	 * Every value in between enables PWM output
 	 */
 	void pwmWrite(unsigned int pin, unsigned int value);
+	/*
+	 * Batched PWM control, sets the <values> of <count> <pins> (see above).
+	 * Only the changed channels are written in a single transaction, pins
+	 * separated by one unchanged channel are updated with a single message
+	 * (the unchanged channel is rewritten from the shadow).
+	 */
+	void pwmWrite(const unsigned int *pins, const unsigned int *values,
+			unsigned int count);
 	/*
 	 * Simple full-on and full-off control
 	 * If value is false, full-off will be enabled
@@ -71,7 +82,7 @@ public:
 	 */
 	void write(unsigned int pin, unsigned short on, unsigned short off);
 	/*
-	 * Reads both on and off registers as 16 bit of data
+	 * Reads both on and off registers as 16 bit of data (from the shadow)
 	 * To get PWM: mask each value with 0xFFF
 	 * To get full-on or full-off bit: mask with 0x1000
 	 */
@@ -94,14 +105,41 @@ public:
 	 * open drain structure (totem pole otherwise).
 	 */
 	void setOutputMode(bool invert, bool openDrain);
+	/*
+	 * Reloads the shadow registers from the device
+	 */
+	void resync();
 private:
 	void setup();
+	//Writes the MODE1 register if its value has changed (always on restart)
+	void setMode1(unsigned char value, bool restart = false);
+	/*
+	 * Updates the registers of a pin in the <channels> (a copy of the shadow),
+	 * returns true if they changed.
+	 */
+	static bool update(unsigned char channels[][4], unsigned int pin,
+			const unsigned char *registers) noexcept;
+	//Updates the registers of a single pin
+	void store(unsigned int pin, const unsigned char *registers);
+	/*
+	 * Writes the <changed> pins of the <channels> in a single transaction, the
+	 * shadow takes the <channels> only if the transaction succeeds.
+	 */
+	void flush(const unsigned char channels[][4], const bool *changed);
 public:
 	static constexpr unsigned int PWM_MAX = 4096;
 	static constexpr unsigned int ALL_LED = 16;
 	//Frequency range: [40-1000 Hz]
 	static constexpr unsigned int MIN_FREQUENCY = 40;
 	static constexpr unsigned int MAX_FREQUENCY = 1000;
+private:
+	struct {
+		unsigned char mode1;
+		unsigned char mode2;
+		unsigned char prescale;
+		//LEDX_ON_L, LEDX_ON_H, LEDX_OFF_L, LEDX_OFF_H (ALL_LED is the last)
+		unsigned char channels[ALL_LED + 1][4];
+	} shadow;
 };
 
 } /* namespace wanhive */
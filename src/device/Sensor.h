@@ -0,0 +1,66 @@
+/*
+ * Sensor.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_SENSOR_H_
+#define DEVICE_SENSOR_H_
+
+namespace wanhive {
+//Maximum number of values in a reading
+constexpr unsigned int SENSOR_FIELDS = 8;
+/**
+ * Description of a sensor and of its readings
+ */
+struct SensorSchema {
+	const char *name; //Sensor's name
+	unsigned int interval; //Sampling interval (milliseconds)
+	unsigned int fields; //Number of values in a reading
+	struct {
+		const char *name;
+		const char *unit;
+	} field[SENSOR_FIELDS];
+};
+
+struct SensorReading {
+	unsigned int sensor; //Sensor's identifier
+	double timestamp; //Unix timestamp
+	double values[SENSOR_FIELDS];
+};
+/**
+ * Periodically sampled sensor interface
+ */
+class Sensor {
+public:
+	virtual ~Sensor() = default;
+	/*
+	 * Returns the sensor's schema
+	 */
+	virtual const SensorSchema& getSchema() const noexcept = 0;
+	/*
+	 * Takes a sample into the <values> (schema.fields of them). Returns false
+	 * if no new reading is available.
+	 */
+	virtual bool sample(double *values) = 0;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_SENSOR_H_ */
@@ -0,0 +1,201 @@
+/*
+ * SensorScheduler.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "SensorScheduler.h"
+#include <wanhive/wanhive-base.h>
+#include <algorithm>
+#include <ctime>
+
+namespace {
+
+double now() noexcept {
+	timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+}  // namespace
+
+namespace wanhive {
+
+SensorScheduler::SensorScheduler(unsigned int resolution) noexcept :
+		resolution(Twiddler::max(resolution, 1U)), count(0), current(0), dropped(
+				0), running(false) {
+	for (auto &slot : slots) {
+		slot = -1;
+	}
+}
+
+SensorScheduler::~SensorScheduler() {
+	stop();
+	for (unsigned int i = 0; i < count; ++i) {
+		delete tasks[i].sensor;
+	}
+}
+
+unsigned int SensorScheduler::add(Sensor *sensor) {
+	if (!sensor) {
+		throw Exception(EX_PARAMETER);
+	} else if (running || count == MAX_SENSORS) {
+		delete sensor;
+		throw Exception(EX_STATE);
+	}
+
+	auto &task = tasks[count];
+	task.sensor = sensor;
+	task.ticks = Twiddler::max(
+			(sensor->getSchema().interval + resolution / 2) / resolution, 1U);
+	task.failing = false;
+	//First sample at the next tick
+	schedule(count, 1);
+	return count++;
+}
+
+void SensorScheduler::start() {
+	if (running) {
+		return;
+	}
+
+	running = true;
+	try {
+		worker = std::thread(&SensorScheduler::work, this);
+	} catch (...) {
+		running = false;
+		throw Exception(EX_RESOURCE);
+	}
+}
+
+unsigned int SensorScheduler::read(SensorReading *readings,
+		unsigned int count) noexcept {
+	unsigned int n = 0;
+	while (n < count && this->readings.pop(readings[n])) {
+		++n;
+	}
+	return n;
+}
+
+unsigned int SensorScheduler::size() const noexcept {
+	return count;
+}
+
+const SensorSchema* SensorScheduler::getSchema(unsigned int id) const noexcept {
+	return (id < count) ? &tasks[id].sensor->getSchema() : nullptr;
+}
+
+unsigned long long SensorScheduler::getDropped() const noexcept {
+	return dropped.load(std::memory_order_relaxed);
+}
+
+void SensorScheduler::work() noexcept {
+	auto period = std::chrono::milliseconds(resolution);
+	auto tick = std::chrono::steady_clock::now();
+	while (true) {
+		//Skip the empty slots
+		auto ticks = distance();
+		tick += period * ticks;
+		if (!next(tick)) {
+			break;
+		}
+
+		current = (current + ticks) % SLOTS;
+		fire();
+		//Don't fall behind by more than a tick after an overrun
+		tick = std::max(tick, std::chrono::steady_clock::now() - period);
+	}
+}
+
+void SensorScheduler::fire() noexcept {
+	//Detach the slot, the tasks are rescheduled while being visited
+	auto index = slots[current];
+	slots[current] = -1;
+	while (index != -1) {
+		auto &task = tasks[index];
+		auto following = task.next;
+		if (task.rounds) {
+			--task.rounds;
+			task.next = slots[current];
+			slots[current] = index;
+			index = following;
+			continue;
+		}
+
+		SensorReading reading;
+		try {
+			if (task.sensor->sample(reading.values)) {
+				reading.sensor = index;
+				reading.timestamp = now();
+				if (!readings.push(reading)) {
+					dropped.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			task.failing = false;
+		} catch (BaseException &e) {
+			//Report the first failure of a series
+			if (!task.failing) {
+				WH_LOG_EXCEPTION(e);
+			}
+			task.failing = true;
+		}
+
+		schedule(index, task.ticks);
+		index = following;
+	}
+}
+
+void SensorScheduler::schedule(unsigned int index, unsigned int ticks) noexcept {
+	auto &task = tasks[index];
+	auto slot = (current + ticks) % SLOTS;
+	task.rounds = (ticks - 1) / SLOTS;
+	task.next = slots[slot];
+	slots[slot] = index;
+}
+
+unsigned int SensorScheduler::distance() const noexcept {
+	for (unsigned int i = 1; i < SLOTS; ++i) {
+		if (slots[(current + i) % SLOTS] != -1) {
+			return i;
+		}
+	}
+	//Empty wheel or only the current slot is occupied
+	return SLOTS;
+}
+
+bool SensorScheduler::next(std::chrono::steady_clock::time_point tick) noexcept {
+	std::unique_lock<std::mutex> lock(mutex);
+	condition.wait_until(lock, tick, [this] {
+		return !running;
+	});
+	return running;
+}
+
+void SensorScheduler::stop() noexcept {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	condition.notify_all();
+	if (worker.joinable()) {
+		worker.join();
+	}
+}
+
+} /* namespace wanhive */
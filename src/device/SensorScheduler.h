@@ -0,0 +1,118 @@
+/*
+ * SensorScheduler.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_SENSORSCHEDULER_H_
+#define DEVICE_SENSORSCHEDULER_H_
+#include "Sensor.h"
+#include "../util/RingBuffer.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace wanhive {
+/**
+ * Samples the registered sensors from a dedicated thread
+ * Every sensor is sampled at the interval declared by its schema (rounded to
+ * the scheduler's resolution). The sampling tasks are kept in a hashed timer
+ * wheel: the thread sleeps until the next occupied slot and the cost of a
+ * tick doesn't depend on the number of sensors waiting in the other slots.
+ * The readings are handed over to a single consumer through a lock-free
+ * queue; the readings which don't fit are dropped.
+ */
+class SensorScheduler {
+public:
+	/*
+	 * <resolution>: duration of a tick (milliseconds)
+	 */
+	SensorScheduler(unsigned int resolution = 10) noexcept;
+	~SensorScheduler();
+	/*
+	 * Takes ownership of the <sensor>, returns its identifier. The sensors are
+	 * registered before the start.
+	 */
+	unsigned int add(Sensor *sensor);
+	/*
+	 * Starts the sampling thread
+	 */
+	void start();
+	/*
+	 * Removes at most <count> oldest readings into <readings> (single
+	 * consumer). Returns the number of readings.
+	 */
+	unsigned int read(SensorReading *readings, unsigned int count) noexcept;
+	/*
+	 * Returns the number of registered sensors
+	 */
+	unsigned int size() const noexcept;
+	/*
+	 * Returns the schema of the sensor identified by <id> (nullptr if none)
+	 */
+	const SensorSchema* getSchema(unsigned int id) const noexcept;
+	/*
+	 * Returns the number of readings dropped because the queue was full
+	 */
+	unsigned long long getDropped() const noexcept;
+private:
+	void work() noexcept;
+	//Samples the sensors of the current slot and reschedules them
+	void fire() noexcept;
+	//Inserts the <index>th task <ticks> ahead of the current slot
+	void schedule(unsigned int index, unsigned int ticks) noexcept;
+	//Returns the number of ticks till the next occupied slot
+	unsigned int distance() const noexcept;
+	//Waits until the <tick>, returns false on stop
+	bool next(std::chrono::steady_clock::time_point tick) noexcept;
+	void stop() noexcept;
+public:
+	static constexpr unsigned int MAX_SENSORS = 16;
+	//Slots in the timer wheel (a round is SLOTS ticks)
+	static constexpr unsigned int SLOTS = 256;
+	//Queue capacity (readings)
+	static constexpr unsigned int CAPACITY = 256;
+private:
+	unsigned int resolution;
+	struct {
+		Sensor *sensor;
+		unsigned int ticks; //Sampling interval
+		unsigned int rounds; //Remaining rounds of the wheel
+		int next; //Next task in the slot (-1: none)
+		bool failing; //The last sample has failed
+	} tasks[MAX_SENSORS];
+	unsigned int count; //Registered sensors
+
+	int slots[SLOTS]; //First task in the slot (-1: none)
+	unsigned int current; //Current slot
+
+	RingBuffer<SensorReading, CAPACITY> readings;
+	std::atomic<unsigned long long> dropped;
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::thread worker;
+	bool running;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_SENSORSCHEDULER_H_ */
@@ -21,6 +21,7 @@
  */
 
 #include "Servo.h"
+#include <wanhive/wanhive-base.h>
 
 namespace wanhive {
 
@@ -34,15 +35,34 @@ Servo::Servo(const char *path, unsigned int device) :
 	setFrequency(FREQUENCY);
 }
 
+Servo::Servo(I2CBus *bus, unsigned int device) :
+		PCA9685(bus, device) {
+	setFrequency(FREQUENCY);
+}
+
 Servo::~Servo() {
 
 }
 
 void Servo::sendPulse(unsigned int pin, float millis) {
+	sendPulses(&pin, &millis, 1);
+}
+
+void Servo::sendPulses(const unsigned int *pins, const float *millis,
+		unsigned int count) {
+	unsigned int values[MAX_PULSES];
+	if (count > MAX_PULSES) {
+		throw Exception(EX_PARAMETER);
+	}
+
 	auto period = 1000.0f / FREQUENCY;
-	int value = (PWM_MAX * millis / period + 0.5f);
-	value = (value >= 0) ? value : 0;
-	pwmWrite(pin, value);
+	for (unsigned int i = 0; i < count; ++i) {
+		int value = (PWM_MAX * millis[i] / period + 0.5f);
+		values[i] = (value >= 0) ? value : 0;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	pwmWrite(pins, values, count);
 }
 
 } /* namespace wanhive */
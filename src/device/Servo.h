@@ -23,20 +23,31 @@
 #ifndef DEVICE_SERVO_H_
 #define DEVICE_SERVO_H_
 #include "PCA9685.h"
+#include <mutex>
 
 namespace wanhive {
 /**
  * PCA9685 servo controller
+ * Thread safe: the servos of a controller can be driven from different threads.
  */
 class Servo: private PCA9685 {
 public:
 	Servo(unsigned int adapter, unsigned int device);
 	Servo(const char *path, unsigned int device);
+	Servo(I2CBus *bus, unsigned int device);
 	~Servo();
 	//1.5ms pulse centers the servo
 	void sendPulse(unsigned int pin, float millis = 1.5);
+	//Sends <count> pulses in a single batch
+	void sendPulses(const unsigned int *pins, const float *millis,
+			unsigned int count);
 public:
 	static constexpr unsigned int FREQUENCY = 50;
+	static constexpr unsigned int MAX_PULSES = 16;
+	//Number of output channels
+	static constexpr unsigned int CHANNELS = 16;
+private:
+	std::mutex mutex;
 };
 
 } /* namespace wanhive */
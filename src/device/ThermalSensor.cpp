@@ -0,0 +1,67 @@
+/*
+ * ThermalSensor.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "ThermalSensor.h"
+#include <wanhive/wanhive-base.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace wanhive {
+
+ThermalSensor::ThermalSensor(unsigned int zone, unsigned int interval) :
+		fd(-1) {
+	char path[64];
+	snprintf(path, sizeof(path), "/sys/class/thermal/thermal_zone%u/temp",
+			zone);
+	if ((fd = open(path, O_RDONLY | O_CLOEXEC)) == -1) {
+		throw SystemException();
+	}
+
+	schema = { "Thermal", interval, 1, { { "Temperature", "C" } } };
+}
+
+ThermalSensor::~ThermalSensor() {
+	close(fd);
+}
+
+const SensorSchema& ThermalSensor::getSchema() const noexcept {
+	return schema;
+}
+
+bool ThermalSensor::sample(double *values) {
+	//The attribute is regenerated on every read from the offset zero
+	char buffer[32];
+	auto bytes = pread(fd, buffer, sizeof(buffer) - 1, 0);
+	if (bytes == -1) {
+		throw SystemException();
+	} else if (!bytes) {
+		return false;
+	}
+
+	buffer[bytes] = '\0';
+	values[0] = strtol(buffer, nullptr, 10) / 1000.0; //Millidegree Celsius
+	return true;
+}
+
+} /* namespace wanhive */
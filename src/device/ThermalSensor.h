@@ -0,0 +1,48 @@
+/*
+ * ThermalSensor.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_THERMALSENSOR_H_
+#define DEVICE_THERMALSENSOR_H_
+#include "Sensor.h"
+
+namespace wanhive {
+/**
+ * Temperature of a thermal zone (e.g. the SoC) reported by the kernel
+ * The reading is the temperature in degree Celsius.
+ */
+class ThermalSensor final: public Sensor {
+public:
+	/*
+	 * Reads the thermal <zone> every <interval> milliseconds
+	 */
+	ThermalSensor(unsigned int zone, unsigned int interval);
+	~ThermalSensor();
+	const SensorSchema& getSchema() const noexcept override;
+	bool sample(double *values) override;
+private:
+	int fd;
+	SensorSchema schema;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_THERMALSENSOR_H_ */
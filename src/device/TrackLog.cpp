@@ -0,0 +1,161 @@
+/*
+ * TrackLog.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "TrackLog.h"
+#include <wanhive/wanhive-base.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace {
+
+//Rounds and clamps the <value> to the range of the integral type T
+template<typename T> T fixed(double value) noexcept {
+	value = std::round(value);
+	if (!(value > std::numeric_limits<T>::min())) { //Also NaN
+		return std::numeric_limits<T>::min();
+	} else if (value > std::numeric_limits<T>::max()) {
+		return std::numeric_limits<T>::max();
+	} else {
+		return (T) value;
+	}
+}
+
+}  // namespace
+
+namespace wanhive {
+
+TrackLog::TrackLog() noexcept :
+		fd(-1), timestamp(0) {
+}
+
+TrackLog::~TrackLog() {
+	close();
+}
+
+void TrackLog::open(const char *path, unsigned long long source) {
+	static_assert(sizeof(TrackHeader) == 16, "Invalid header size");
+	static_assert(sizeof(TrackEntry) == 32, "Invalid entry size");
+	close();
+	if (!path) {
+		throw Exception(EX_PARAMETER);
+	} else if ((fd = ::open(path, O_RDWR | O_CREAT | O_APPEND, 0644)) == -1) {
+		throw SystemException();
+	}
+
+	try {
+		struct stat info;
+		if (fstat(fd, &info) == -1) {
+			throw SystemException();
+		}
+
+		TrackHeader header;
+		if (info.st_size == 0) {
+			header.magic = MAGIC;
+			header.version = VERSION;
+			header.source = source;
+			if (::write(fd, &header, sizeof(header)) != sizeof(header)) {
+				throw SystemException();
+			}
+			timestamp = 0;
+			return;
+		}
+
+		if (pread(fd, &header, sizeof(header), 0) != sizeof(header)
+				|| header.magic != MAGIC || header.version != VERSION) {
+			throw Exception(EX_RESOURCE);
+		}
+
+		//Discard the partial entry, resume after the last entry
+		auto entries = (info.st_size - sizeof(header)) / sizeof(TrackEntry);
+		auto size = sizeof(header) + entries * sizeof(TrackEntry);
+		if ((size_t) info.st_size != size && ftruncate(fd, size) == -1) {
+			throw SystemException();
+		}
+
+		TrackEntry last;
+		timestamp = 0;
+		if (entries
+				&& pread(fd, &last, sizeof(last), size - sizeof(last))
+						== sizeof(last)) {
+			timestamp = last.timestamp;
+		}
+	} catch (BaseException &e) {
+		close();
+		throw;
+	}
+}
+
+bool TrackLog::append(const GeoLocation &location) {
+	if (!isOpen()) {
+		throw Exception(EX_STATE);
+	}
+
+	TrackEntry entry;
+	encode(location, entry);
+	//The log must remain sorted by time
+	if (entry.timestamp <= timestamp) {
+		return false;
+	}
+
+	//A single write, the log never contains a torn entry on success
+	auto n = ::write(fd, &entry, sizeof(entry));
+	if (n == sizeof(entry)) {
+		timestamp = entry.timestamp;
+		return true;
+	} else if (n == -1) {
+		throw SystemException();
+	} else {
+		throw Exception(EX_RESOURCE);
+	}
+}
+
+void TrackLog::close() noexcept {
+	if (fd != -1) {
+		fdatasync(fd);
+		::close(fd);
+	}
+	fd = -1;
+	timestamp = 0;
+}
+
+bool TrackLog::isOpen() const noexcept {
+	return fd != -1;
+}
+
+void TrackLog::encode(const GeoLocation &location,
+		TrackEntry &entry) noexcept {
+	memset(&entry, 0, sizeof(entry));
+	entry.timestamp = fixed<uint64_t>(location.timestamp * 1000);
+	entry.latitude = fixed<int32_t>(location.latitude * 1e7);
+	entry.longitude = fixed<int32_t>(location.longitude * 1e7);
+	entry.altitude = fixed<int32_t>(location.altitude * 1000);
+	entry.speed = fixed<uint16_t>(location.speed * 100);
+	entry.heading = fixed<uint16_t>(location.heading * 100);
+	entry.climb = fixed<int16_t>(location.climb * 100);
+	entry.mode = location.mode;
+}
+
+} /* namespace wanhive */
@@ -0,0 +1,96 @@
+/*
+ * TrackLog.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_TRACKLOG_H_
+#define DEVICE_TRACKLOG_H_
+#include "GeoSource.h"
+#include <cstdint>
+
+namespace wanhive {
+/**
+ * Header of a GPS track log
+ */
+struct TrackHeader {
+	uint32_t magic; //Always TrackLog::MAGIC
+	uint32_t version; //Always TrackLog::VERSION
+	uint64_t source; //Identifier of the track's source
+};
+/**
+ * Track log entry (a GPS fix in fixed point)
+ */
+struct TrackEntry {
+	uint64_t timestamp; //Time of the fix (milliseconds since the epoch)
+	int32_t latitude; //Degrees x 10^7
+	int32_t longitude; //Degrees x 10^7
+	int32_t altitude; //Millimeters over mean sea level
+	uint16_t speed; //Centimeters per second
+	uint16_t heading; //Degrees x 100 wrt true North
+	int16_t climb; //Centimeters per second
+	uint8_t mode; //2D lock (2); 3D Lock (3)
+	uint8_t reserved[5]; //Padding
+};
+
+/**
+ * Append-only binary log of the GPS fixes
+ * The log is a header followed by fixed-size entries sorted by time, hence
+ * the recordings can be geo-indexed by memory mapping the log and searching
+ * it by timestamp.
+ */
+class TrackLog {
+public:
+	TrackLog() noexcept;
+	~TrackLog();
+	/*
+	 * Opens the log at <path> for appending (closes the current log). A new
+	 * log is created with the given <source> identifier. A trailing partial
+	 * entry, left behind by a crash, is discarded.
+	 */
+	void open(const char *path, unsigned long long source);
+	/*
+	 * Appends a fix, the fixes older than the last entry are ignored.
+	 * Returns true if the fix was written.
+	 */
+	bool append(const GeoLocation &location);
+	/*
+	 * Closes the log (flushed to the disk)
+	 */
+	void close() noexcept;
+	/*
+	 * Returns true if the log is open
+	 */
+	bool isOpen() const noexcept;
+	/*
+	 * Translates a <location> into a log entry
+	 */
+	static void encode(const GeoLocation &location,
+			TrackEntry &entry) noexcept;
+public:
+	static constexpr uint32_t MAGIC = 0x4C544857; //"WHTL"
+	static constexpr uint32_t VERSION = 1;
+private:
+	int fd;
+	unsigned long long timestamp; //Timestamp of the last entry
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_TRACKLOG_H_ */
@@ -0,0 +1,89 @@
+/*
+ * Tracker.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Tracker.h"
+#include <cmath>
+
+namespace wanhive {
+
+Tracker::Tracker() noexcept :
+		proportional(0), integral(0), speed(0), deadband(0), timestamp(0) {
+	sums[0] = 0;
+	sums[1] = 0;
+}
+
+Tracker::~Tracker() {
+
+}
+
+void Tracker::setGains(float proportional, float integral) noexcept {
+	this->proportional = fabs(proportional);
+	this->integral = fabs(integral);
+}
+
+void Tracker::setLimits(float speed, float deadband) noexcept {
+	this->speed = fabs(speed);
+	this->deadband = fabs(deadband);
+}
+
+void Tracker::reset() noexcept {
+	sums[0] = 0;
+	sums[1] = 0;
+	timestamp = 0;
+}
+
+void Tracker::update(double timestamp, float x, float y,
+		float rates[2]) noexcept {
+	auto dt = timestamp - this->timestamp;
+	if (!this->timestamp || dt <= 0 || dt > MAX_GAP) {
+		//Nothing to integrate over
+		sums[0] = 0;
+		sums[1] = 0;
+		dt = 0;
+	}
+	this->timestamp = timestamp;
+
+	float offsets[2] = { x, y };
+	for (unsigned int i = 0; i < 2; ++i) {
+		auto offset = offsets[i];
+		if (fabs(offset) <= deadband) {
+			//Centered: hold still, keep the integral
+			rates[i] = 0;
+			continue;
+		}
+
+		auto sum = sums[i] + offset * dt;
+		auto rate = proportional * offset + integral * sum;
+		if (fabs(rate) > speed) {
+			rate = (rate > 0) ? speed : -speed;
+			//Integrate only if it pulls the output back from the limit
+			if (sums[i] * offset < 0) {
+				sums[i] = sum;
+			}
+		} else {
+			sums[i] = sum;
+		}
+		rates[i] = rate;
+	}
+}
+
+} /* namespace wanhive */
@@ -0,0 +1,73 @@
+/*
+ * Tracker.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_TRACKER_H_
+#define DEVICE_TRACKER_H_
+
+namespace wanhive {
+/**
+ * Two axis PI controller which turns the target's offset from the center of
+ * the frame into the angular rates which bring it back to the center
+ * The integral stops growing while the output saturates (anti-windup), and
+ * restarts after a long gap in the measurements.
+ */
+class Tracker {
+public:
+	Tracker() noexcept;
+	~Tracker();
+	/*
+	 * Sets the <proportional> gain (degrees per second at the frame's edge)
+	 * and the <integral> gain (degrees per second per second at the edge).
+	 */
+	void setGains(float proportional, float integral) noexcept;
+	/*
+	 * Sets the maximum <speed> (degrees per second) and the <deadband>
+	 * (fraction of the half frame) within which the target counts as
+	 * centered.
+	 */
+	void setLimits(float speed, float deadband) noexcept;
+	/*
+	 * Forgets the integrals
+	 */
+	void reset() noexcept;
+	/*
+	 * Feeds the target's offset from the center measured at the <timestamp>
+	 * (seconds): <x> to the right and <y> down, as fractions of the half
+	 * frame. Returns the horizontal and the vertical rates (degrees per
+	 * second, positive toward the right and down) in <rates>.
+	 */
+	void update(double timestamp, float x, float y, float rates[2]) noexcept;
+public:
+	//Longest gap between the measurements (seconds)
+	static constexpr double MAX_GAP = 1;
+private:
+	float proportional;
+	float integral;
+	float speed;
+	float deadband;
+	float sums[2]; //Integrals of the offsets
+	double timestamp; //Of the last measurement (0: none)
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_TRACKER_H_ */
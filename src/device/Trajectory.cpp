@@ -0,0 +1,103 @@
+/*
+ * Trajectory.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Trajectory.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+//Distance at which the axis snaps to the target
+constexpr float EPSILON = 0.01f;
+
+}  // namespace
+
+namespace wanhive {
+
+Trajectory::Trajectory() noexcept :
+		speed(0), acceleration(0), target(0), position(0), velocity(0) {
+
+}
+
+Trajectory::~Trajectory() {
+
+}
+
+void Trajectory::setLimits(float speed, float acceleration) noexcept {
+	this->speed = std::max(speed, 0.0f);
+	this->acceleration = std::max(acceleration, 0.0f);
+}
+
+void Trajectory::reset(float position) noexcept {
+	this->target = position;
+	this->position = position;
+	this->velocity = 0;
+}
+
+void Trajectory::setTarget(float target) noexcept {
+	this->target = target;
+}
+
+float Trajectory::getTarget() const noexcept {
+	return target;
+}
+
+float Trajectory::step(float dt) noexcept {
+	auto distance = target - position;
+	auto dv = acceleration * dt;
+	if (!speed || !acceleration
+			|| (std::fabs(distance) < EPSILON && std::fabs(velocity) <= dv)) {
+		position = target;
+		velocity = 0;
+		return position;
+	}
+
+	//The fastest velocity which still allows to stop at the target
+	auto limit = std::min(speed,
+			std::sqrt(2 * acceleration * std::fabs(distance)));
+	auto desired = std::copysign(limit, distance);
+	velocity = std::min(std::max(desired, velocity - dv), velocity + dv);
+	auto next = position + velocity * dt;
+
+	//Don't overshoot the target
+	if ((target - next) * distance <= 0 && velocity * distance > 0) {
+		position = target;
+		velocity = 0;
+	} else {
+		position = next;
+	}
+	return position;
+}
+
+float Trajectory::getPosition() const noexcept {
+	return position;
+}
+
+float Trajectory::getVelocity() const noexcept {
+	return velocity;
+}
+
+bool Trajectory::isIdle() const noexcept {
+	return position == target && velocity == 0;
+}
+
+} /* namespace wanhive */
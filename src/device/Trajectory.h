@@ -0,0 +1,72 @@
+/*
+ * Trajectory.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DEVICE_TRAJECTORY_H_
+#define DEVICE_TRAJECTORY_H_
+
+namespace wanhive {
+/**
+ * Single axis motion planner
+ * Generates a trapezoidal velocity profile towards the target position under
+ * the speed and acceleration limits. The profile is recomputed on every step,
+ * hence the target may change while the axis is moving.
+ */
+class Trajectory {
+public:
+	Trajectory() noexcept;
+	~Trajectory();
+	/*
+	 * Sets the maximum <speed> (units per second) and <acceleration> (units
+	 * per second squared). If either of them is zero then the axis jumps to
+	 * the target in a single step.
+	 */
+	void setLimits(float speed, float acceleration) noexcept;
+	/*
+	 * Stops the axis at the given position
+	 */
+	void reset(float position) noexcept;
+	/*
+	 * Sets the target position
+	 */
+	void setTarget(float target) noexcept;
+	float getTarget() const noexcept;
+	/*
+	 * Advances the profile by <dt> seconds, returns the new position
+	 */
+	float step(float dt) noexcept;
+	float getPosition() const noexcept;
+	float getVelocity() const noexcept;
+	/*
+	 * Returns true if the axis rests at the target
+	 */
+	bool isIdle() const noexcept;
+private:
+	float speed;
+	float acceleration;
+	float target;
+	float position;
+	float velocity;
+};
+
+} /* namespace wanhive */
+
+#endif /* DEVICE_TRAJECTORY_H_ */
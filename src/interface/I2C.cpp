@@ -21,172 +21,196 @@
  */
 
 #include "I2C.h"
+#include "I2CAdapter.h"
 #include <wanhive/wanhive-base.h>
-#include <fcntl.h>
-#include <unistd.h>
-#include <sys/ioctl.h>
-extern "C" {
-#include <linux/i2c-dev.h>
-#include <i2c/smbus.h>
-}
+#include <cstring>
 
 namespace wanhive {
 
 I2C::I2C(unsigned int bus, unsigned int device) :
-		fd(-1) {
-	char path[32];
-	snprintf(path, sizeof(path), "/dev/i2c-%u", bus);
-	open(path, device);
+		bus(new I2CAdapter(bus)), owner(true), address(device) {
+	begin();
 }
 
 I2C::I2C(const char *path, unsigned int device) :
-		fd(-1) {
-	open(path, device);
+		bus(new I2CAdapter(path)), owner(true), address(device) {
+	begin();
+}
+
+I2C::I2C(I2CBus *bus, unsigned int device) :
+		bus(bus), owner(false), address(device) {
+	if (!bus) {
+		throw Exception(EX_PARAMETER);
+	}
+	begin();
 }
 
 I2C::~I2C() {
-	close();
+	if (owner) {
+		delete bus;
+	}
 }
 
 unsigned int I2C::read(unsigned char command, unsigned int count,
 		void *buffer) {
-	auto rv = i2c_smbus_read_i2c_block_data(fd, command, count,
-			(unsigned char*) buffer);
-	if (rv < 0) {
-		throw SystemException();
-	} else {
-		return rv;
-	}
+	union i2c_smbus_data data;
+	count = (count > I2C_SMBUS_BLOCK_MAX) ? I2C_SMBUS_BLOCK_MAX : count;
+	data.block[0] = count;
+	access(I2C_SMBUS_READ, command,
+			(count == I2C_SMBUS_BLOCK_MAX) ?
+					I2C_SMBUS_I2C_BLOCK_BROKEN : I2C_SMBUS_I2C_BLOCK_DATA,
+			&data);
+	memcpy(buffer, data.block + 1, data.block[0]);
+	return data.block[0];
 }
 
 void I2C::write(unsigned char command, unsigned int count, const void *buffer) {
-	if (i2c_smbus_write_i2c_block_data(fd, command, count,
-			(const unsigned char*) buffer) < 0) {
-		throw SystemException();
-	}
+	union i2c_smbus_data data;
+	count = (count > I2C_SMBUS_BLOCK_MAX) ? I2C_SMBUS_BLOCK_MAX : count;
+	data.block[0] = count;
+	memcpy(data.block + 1, buffer, count);
+	access(I2C_SMBUS_WRITE, command, I2C_SMBUS_I2C_BLOCK_BROKEN, &data);
 }
 
 void I2C::read(unsigned char command, unsigned char &value) {
-	auto rv = i2c_smbus_read_byte_data(fd, command);
-	if (rv < 0) {
-		throw SystemException();
-	} else {
-		value = rv & 0xFF;
-	}
+	value = readByte(command);
 }
 
 unsigned char I2C::readByte(unsigned char command) {
-	auto rv = i2c_smbus_read_byte_data(fd, command);
-	if (rv < 0) {
-		throw SystemException();
-	} else {
-		return (rv & 0xFF);
-	}
+	union i2c_smbus_data data;
+	access(I2C_SMBUS_READ, command, I2C_SMBUS_BYTE_DATA, &data);
+	return data.byte;
 }
 
 void I2C::write(unsigned char command, unsigned char value) {
-	if (i2c_smbus_write_byte_data(fd, command, value) < 0) {
-		throw SystemException();
-	}
+	union i2c_smbus_data data;
+	data.byte = value;
+	access(I2C_SMBUS_WRITE, command, I2C_SMBUS_BYTE_DATA, &data);
 }
 
 void I2C::read(unsigned char command, unsigned short &value) {
-	auto rv = i2c_smbus_read_word_data(fd, command);
-	if (rv < 0) {
-		throw SystemException();
-	} else {
-		value = rv & 0xFFFF;
-	}
+	value = readWord(command);
 }
 
 unsigned short I2C::readWord(unsigned char command) {
-	auto rv = i2c_smbus_read_word_data(fd, command);
-	if (rv < 0) {
-		throw SystemException();
-	} else {
-		return (rv & 0xFFFF);
-	}
+	union i2c_smbus_data data;
+	access(I2C_SMBUS_READ, command, I2C_SMBUS_WORD_DATA, &data);
+	return data.word;
 }
 
 void I2C::write(unsigned char command, unsigned short value) {
-	if (i2c_smbus_write_word_data(fd, command, value) < 0) {
-		throw SystemException();
-	}
+	union i2c_smbus_data data;
+	data.word = value;
+	access(I2C_SMBUS_WRITE, command, I2C_SMBUS_WORD_DATA, &data);
 }
 
 void I2C::read(unsigned char &value) {
-	auto rv = i2c_smbus_read_byte(fd);
-	if (rv < 0) {
-		throw SystemException();
-	} else {
-		value = rv & 0xFF;
-	}
+	value = read();
 }
 
 unsigned char I2C::read() {
-	auto rv = i2c_smbus_read_byte(fd);
-	if (rv < 0) {
-		throw SystemException();
-	} else {
-		return (rv & 0xFF);
-	}
+	union i2c_smbus_data data;
+	access(I2C_SMBUS_READ, 0, I2C_SMBUS_BYTE, &data);
+	return data.byte;
 }
 
 void I2C::write(unsigned char value) {
-	if (i2c_smbus_write_byte(fd, value) < 0) {
-		throw SystemException();
-	}
+	access(I2C_SMBUS_WRITE, value, I2C_SMBUS_BYTE, nullptr);
 }
 
 void I2C::quickWrite(unsigned char value) {
-	if (i2c_smbus_write_quick(fd, value) < 0) {
-		throw SystemException();
-	}
+	access(value, 0, I2C_SMBUS_QUICK, nullptr);
 }
 
 unsigned int I2C::process(unsigned char command, unsigned int count,
 		void *buffer) {
-	auto rv = i2c_smbus_block_process_call(fd, command, count,
-			(unsigned char*) buffer);
-	if (rv < 0) {
-		throw SystemException();
-	} else {
-		return rv;
-	}
+	union i2c_smbus_data data;
+	count = (count > I2C_SMBUS_BLOCK_MAX) ? I2C_SMBUS_BLOCK_MAX : count;
+	data.block[0] = count;
+	memcpy(data.block + 1, buffer, count);
+	access(I2C_SMBUS_WRITE, command, I2C_SMBUS_BLOCK_PROC_CALL, &data);
+	memcpy(buffer, data.block + 1, data.block[0]);
+	return data.block[0];
 }
 
 unsigned short I2C::process(unsigned char command, unsigned short value) {
-	auto rv = i2c_smbus_process_call(fd, command, value);
-	if (rv < 0) {
+	union i2c_smbus_data data;
+	data.word = value;
+	access(I2C_SMBUS_WRITE, command, I2C_SMBUS_PROC_CALL, &data);
+	return data.word;
+}
+
+void I2C::begin() noexcept {
+	transaction.count = 0;
+	transaction.size = 0;
+}
+
+void I2C::queueWrite(unsigned char command, unsigned int count,
+		const void *buffer) {
+	if ((count + 1) > (MAX_WRITE - transaction.size)) {
+		throw Exception(EX_OVERFLOW);
+	}
+
+	//The register address followed by the data
+	auto data = transaction.buffer + transaction.size;
+	data[0] = command;
+	memcpy(data + 1, buffer, count);
+	queue(0, count + 1, data);
+	transaction.size += (count + 1);
+}
+
+void I2C::queueRead(unsigned char command, unsigned int count, void *buffer) {
+	if ((transaction.count + 2) > MAX_MESSAGES
+			|| transaction.size == MAX_WRITE) {
+		throw Exception(EX_OVERFLOW);
+	}
+
+	//Set the register address, read after a repeated start
+	auto data = transaction.buffer + transaction.size;
+	data[0] = command;
+	queue(0, 1, data);
+	transaction.size += 1;
+	queue(I2C_M_RD, count, (unsigned char*) buffer);
+}
+
+void I2C::commit() {
+	if (!transaction.count) {
+		return;
+	}
+
+	struct i2c_msg messages[MAX_MESSAGES];
+	for (unsigned int i = 0; i < transaction.count; ++i) {
+		messages[i].addr = address;
+		messages[i].flags = transaction.messages[i].flags;
+		messages[i].len = transaction.messages[i].length;
+		messages[i].buf = transaction.messages[i].data;
+	}
+
+	auto count = transaction.count;
+	begin();
+	if (bus->transfer(messages, count) < 0) {
 		throw SystemException();
-	} else {
-		return (rv & 0xFFFF);
 	}
 }
 
-void I2C::open(const char *path, unsigned int device) {
-	static_assert(((sizeof(unsigned int) == 4) && (CHAR_BIT == 8)),
-			"Unsupported platform");
-	try {
-		close(); //Just in case
-		if ((fd = ::open(path, O_RDWR)) == -1) {
-			throw SystemException();
-		} else if (ioctl(fd, I2C_SLAVE, device) == -1) {
-			throw SystemException();
-		} else {
-			//success
-		}
-	} catch (BaseException &e) {
-		close();
-		throw;
+void I2C::access(char readWrite, unsigned char command, int size,
+		union i2c_smbus_data *data) {
+	if (bus->access(address, readWrite, command, size, data) < 0) {
+		throw SystemException();
 	}
 }
 
-void I2C::close() noexcept {
-	if (fd != -1) {
-		::close(fd);
+void I2C::queue(unsigned short flags, unsigned int count,
+		unsigned char *data) {
+	//The kernel limits the message size to 8192 bytes
+	if (transaction.count == MAX_MESSAGES || count > 8192) {
+		throw Exception(EX_OVERFLOW);
 	}
-	fd = -1;
+
+	auto &message = transaction.messages[transaction.count++];
+	message.flags = flags;
+	message.length = count;
+	message.data = data;
 }
 
 } /* namespace wanhive */
@@ -22,10 +22,13 @@
 
 #ifndef INTERFACE_I2C_H_
 #define INTERFACE_I2C_H_
+#include "I2CBus.h"
 
 namespace wanhive {
 /**
- * User space I2C bus driver (uses libi2c)
+ * User space I2C device driver
+ * The transfers are carried out by a bus backend (the kernel adapter unless
+ * a different backend is provided).
  */
 class I2C {
 public:
@@ -33,6 +36,8 @@ public:
 	I2C(unsigned int bus, unsigned int device);
 	//Initialize an I2C device at the given pathname
 	I2C(const char *path, unsigned int device);
+	//Initializes an I2C device on the given <bus> (caller retains ownership)
+	I2C(I2CBus *bus, unsigned int device);
 	~I2C();
 
 	/**
@@ -77,11 +82,46 @@ public:
 			void *buffer);
 	//Returns the unsigned word received from the device
 	unsigned short process(unsigned char command, unsigned short value);
+
+	/**
+	 * Combined transactions (I2C_RDWR): the queued messages are submitted
+	 * with a single system call and are separated by repeated starts. The
+	 * transfers are not restricted by the SMBus block size, the adapter must
+	 * support plain I2C.
+	 */
+	//Discards the queued messages
+	void begin() noexcept;
+	//Queues a register write, <buffer> is copied
+	void queueWrite(unsigned char command, unsigned int count,
+			const void *buffer);
+	//Queues a register read, <buffer> must remain valid until commit
+	void queueRead(unsigned char command, unsigned int count, void *buffer);
+	//Submits the queued messages, clears the queue on return
+	void commit();
 private:
-	void open(const char *path, unsigned int device);
-	void close() noexcept;
+	//SMBus access, throws on error
+	void access(char readWrite, unsigned char command, int size,
+			union i2c_smbus_data *data);
+	void queue(unsigned short flags, unsigned int count, unsigned char *data);
+public:
+	//Maximum number of messages in a transaction (I2C_RDWR_IOCTL_MAX_MSGS)
+	static constexpr unsigned int MAX_MESSAGES = 42;
+	//Maximum number of bytes written in a transaction
+	static constexpr unsigned int MAX_WRITE = 1024;
 private:
-	int fd;
+	I2CBus *bus;
+	bool owner; //Owns the bus backend
+	unsigned int address;
+	struct {
+		unsigned int count; //Queued messages
+		unsigned int size; //Buffered bytes
+		struct {
+			unsigned short flags;
+			unsigned short length;
+			unsigned char *data;
+		} messages[MAX_MESSAGES];
+		unsigned char buffer[MAX_WRITE];
+	} transaction;
 };
 
 } /* namespace wanhive */
@@ -0,0 +1,177 @@
+/*
+ * I2CAdapter.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "I2CAdapter.h"
+#include <wanhive/wanhive-base.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+extern "C" {
+#include <linux/i2c-dev.h>
+#include <i2c/smbus.h>
+}
+
+namespace {
+
+constexpr unsigned int NO_ADDRESS = ~0U;
+
+}  // namespace
+
+namespace wanhive {
+
+I2CAdapter::I2CAdapter(unsigned int bus) :
+		fd(-1), address(NO_ADDRESS), functions(0) {
+	char path[32];
+	snprintf(path, sizeof(path), "/dev/i2c-%u", bus);
+	open(path);
+}
+
+I2CAdapter::I2CAdapter(const char *path) :
+		fd(-1), address(NO_ADDRESS), functions(0) {
+	open(path);
+}
+
+I2CAdapter::~I2CAdapter() {
+	close();
+}
+
+int I2CAdapter::access(unsigned int address, char readWrite,
+		unsigned char command, int size, union i2c_smbus_data *data) noexcept {
+	if (!select(address)) {
+		return -1;
+	} else {
+		return i2c_smbus_access(fd, readWrite, command, size, data);
+	}
+}
+
+int I2CAdapter::transfer(struct i2c_msg *messages,
+		unsigned int count) noexcept {
+	if (functions & I2C_FUNC_I2C) {
+		struct i2c_rdwr_ioctl_data data;
+		data.msgs = messages;
+		data.nmsgs = count;
+		return ioctl(fd, I2C_RDWR, &data);
+	} else {
+		return emulate(messages, count);
+	}
+}
+
+void I2CAdapter::open(const char *path) {
+	try {
+		close(); //Just in case
+		if ((fd = ::open(path, O_RDWR)) == -1) {
+			throw SystemException();
+		} else if (ioctl(fd, I2C_FUNCS, &functions) == -1) {
+			throw SystemException();
+		} else {
+			//success
+		}
+	} catch (BaseException &e) {
+		close();
+		throw;
+	}
+}
+
+void I2CAdapter::close() noexcept {
+	if (fd != -1) {
+		::close(fd);
+	}
+	fd = -1;
+	address = NO_ADDRESS;
+}
+
+bool I2CAdapter::select(unsigned int address) noexcept {
+	if (address == this->address) {
+		return true;
+	} else if (ioctl(fd, I2C_SLAVE, address) == -1) {
+		this->address = NO_ADDRESS;
+		return false;
+	} else {
+		this->address = address;
+		return true;
+	}
+}
+
+int I2CAdapter::emulate(struct i2c_msg *messages,
+		unsigned int count) noexcept {
+	union i2c_smbus_data data;
+	for (unsigned int i = 0; i < count; ++i) {
+		auto &message = messages[i];
+		//Every message must start with the register address
+		if ((message.flags & I2C_M_RD) || !message.len) {
+			errno = EOPNOTSUPP;
+			return -1;
+		} else if (!select(message.addr)) {
+			return -1;
+		}
+
+		unsigned char command = message.buf[0];
+		if (message.len == 1 && (i + 1) < count
+				&& (messages[i + 1].flags & I2C_M_RD)
+				&& messages[i + 1].addr == message.addr) {
+			//Register read
+			auto &reply = messages[++i];
+			for (unsigned int offset = 0; offset < reply.len;) {
+				unsigned int n = reply.len - offset;
+				n = (n > I2C_SMBUS_BLOCK_MAX) ? I2C_SMBUS_BLOCK_MAX : n;
+				data.block[0] = n;
+				if (i2c_smbus_access(fd, I2C_SMBUS_READ, command + offset,
+						(n == I2C_SMBUS_BLOCK_MAX) ?
+								I2C_SMBUS_I2C_BLOCK_BROKEN :
+								I2C_SMBUS_I2C_BLOCK_DATA, &data) < 0) {
+					return -1;
+				} else if (data.block[0] < n) {
+					errno = EIO;
+					return -1;
+				} else {
+					memcpy(reply.buf + offset, data.block + 1, n);
+					offset += n;
+				}
+			}
+		} else if (message.len == 1) {
+			//Sets the register pointer
+			if (i2c_smbus_access(fd, I2C_SMBUS_WRITE, command, I2C_SMBUS_BYTE,
+					nullptr) < 0) {
+				return -1;
+			}
+		} else {
+			//Register write
+			for (unsigned int offset = 1; offset < message.len;) {
+				unsigned int n = message.len - offset;
+				n = (n > I2C_SMBUS_BLOCK_MAX) ? I2C_SMBUS_BLOCK_MAX : n;
+				data.block[0] = n;
+				memcpy(data.block + 1, message.buf + offset, n);
+				if (i2c_smbus_access(fd, I2C_SMBUS_WRITE, command + offset - 1,
+						I2C_SMBUS_I2C_BLOCK_BROKEN, &data) < 0) {
+					return -1;
+				} else {
+					offset += n;
+				}
+			}
+		}
+	}
+	return count;
+}
+
+} /* namespace wanhive */
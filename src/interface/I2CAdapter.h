@@ -0,0 +1,60 @@
+/*
+ * I2CAdapter.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INTERFACE_I2CADAPTER_H_
+#define INTERFACE_I2CADAPTER_H_
+#include "I2CBus.h"
+
+namespace wanhive {
+/**
+ * Kernel I2C adapter (/dev/i2c-N), uses libi2c
+ * Combined transfers are emulated with SMBus block transfers if the adapter
+ * supports only SMBus (e.g. the i2c-stub module). The emulation relies on the
+ * register auto-increment of the devices.
+ */
+class I2CAdapter final: public I2CBus {
+public:
+	//Opens the adapter with the given bus number
+	I2CAdapter(unsigned int bus);
+	//Opens the adapter at the given pathname
+	I2CAdapter(const char *path);
+	~I2CAdapter();
+
+	int access(unsigned int address, char readWrite, unsigned char command,
+			int size, union i2c_smbus_data *data) noexcept override;
+	int transfer(struct i2c_msg *messages, unsigned int count) noexcept
+			override;
+private:
+	void open(const char *path);
+	void close() noexcept;
+	//Sets the address of the device for the SMBus transfers
+	bool select(unsigned int address) noexcept;
+	int emulate(struct i2c_msg *messages, unsigned int count) noexcept;
+private:
+	int fd;
+	unsigned int address; //Currently selected device
+	unsigned long functions; //Adapter functionality
+};
+
+} /* namespace wanhive */
+
+#endif /* INTERFACE_I2CADAPTER_H_ */
@@ -0,0 +1,55 @@
+/*
+ * I2CBus.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INTERFACE_I2CBUS_H_
+#define INTERFACE_I2CBUS_H_
+extern "C" {
+#include <linux/i2c.h>
+}
+
+namespace wanhive {
+/**
+ * I2C bus backend interface
+ * Carries out the SMBus and the combined I2C transfers on behalf of the
+ * devices attached to the bus. The methods return a negative value and set
+ * errno on error (like the kernel interface).
+ */
+class I2CBus {
+public:
+	virtual ~I2CBus() = default;
+	/*
+	 * SMBus access (see i2c_smbus_access) to the device at <address>
+	 */
+	virtual int access(unsigned int address, char readWrite,
+			unsigned char command, int size,
+			union i2c_smbus_data *data) noexcept = 0;
+	/*
+	 * Combined transfer (see I2C_RDWR) of <count> messages, every message
+	 * carries its own address.
+	 */
+	virtual int transfer(struct i2c_msg *messages,
+			unsigned int count) noexcept = 0;
+};
+
+} /* namespace wanhive */
+
+#endif /* INTERFACE_I2CBUS_H_ */
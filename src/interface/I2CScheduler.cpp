@@ -0,0 +1,262 @@
+/*
+ * I2CScheduler.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "I2CScheduler.h"
+#include <wanhive/wanhive-base.h>
+#include <cerrno>
+#include <vector>
+
+namespace {
+
+constexpr unsigned int NO_ADDRESS = ~0U;
+
+}  // namespace
+
+namespace wanhive {
+
+I2CScheduler::I2CScheduler(I2CBus *bus) :
+		bus(bus), running(true) {
+	if (!bus) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	for (unsigned int i = 0; i < PRIORITIES; ++i) {
+		channels[i].scheduler = this;
+		channels[i].priority = (Priority) i;
+	}
+
+	try {
+		worker = std::thread(&I2CScheduler::work, this);
+	} catch (...) {
+		delete bus;
+		throw Exception(EX_RESOURCE);
+	}
+}
+
+I2CScheduler::~I2CScheduler() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	condition.notify_all();
+	if (worker.joinable()) {
+		worker.join();
+	}
+	delete bus;
+}
+
+int I2CScheduler::access(unsigned int address, char readWrite,
+		unsigned char command, int size, union i2c_smbus_data *data) noexcept {
+	return channels[CONTROL].access(address, readWrite, command, size, data);
+}
+
+int I2CScheduler::transfer(struct i2c_msg *messages,
+		unsigned int count) noexcept {
+	return channels[CONTROL].transfer(messages, count);
+}
+
+std::future<int> I2CScheduler::submit(Priority priority, unsigned int address,
+		char readWrite, unsigned char command, int size,
+		union i2c_smbus_data *data) {
+	Job job;
+	job.messages = nullptr;
+	job.count = 0;
+	job.address = address;
+	job.readWrite = readWrite;
+	job.command = command;
+	job.size = size;
+	job.data = data;
+	return enqueue(priority, std::move(job));
+}
+
+std::future<int> I2CScheduler::submit(Priority priority,
+		struct i2c_msg *messages, unsigned int count) {
+	if (!messages || !count || count > MAX_MESSAGES) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	Job job;
+	job.messages = messages;
+	job.count = count;
+	job.address = NO_ADDRESS;
+	job.readWrite = 0;
+	job.command = 0;
+	job.size = 0;
+	job.data = nullptr;
+	return enqueue(priority, std::move(job));
+}
+
+I2CBus* I2CScheduler::channel(Priority priority) noexcept {
+	return &channels[(priority < PRIORITIES) ? priority : POLL];
+}
+
+int I2CScheduler::Channel::access(unsigned int address, char readWrite,
+		unsigned char command, int size, union i2c_smbus_data *data) noexcept {
+	try {
+		return wait(
+				scheduler->submit(priority, address, readWrite, command, size,
+						data));
+	} catch (...) {
+		errno = ENOMEM;
+		return -1;
+	}
+}
+
+int I2CScheduler::Channel::transfer(struct i2c_msg *messages,
+		unsigned int count) noexcept {
+	try {
+		return wait(scheduler->submit(priority, messages, count));
+	} catch (...) {
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+std::future<int> I2CScheduler::enqueue(Priority priority, Job &&job) {
+	auto result = job.result.get_future();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!running) {
+			throw Exception(EX_STATE);
+		}
+		queues[(priority < PRIORITIES) ? priority : POLL].push_back(
+				std::move(job));
+	}
+	condition.notify_one();
+	return result;
+}
+
+void I2CScheduler::work() noexcept {
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true) {
+		condition.wait(lock, [this] {
+			if (!running) {
+				return true;
+			}
+			for (auto &q : queues) {
+				if (!q.empty()) {
+					return true;
+				}
+			}
+			return false;
+		});
+
+		if (!running) {
+			break;
+		}
+
+		for (auto &q : queues) {
+			if (!q.empty()) {
+				auto job = std::move(q.front());
+				q.pop_front();
+				execute(job, q);
+				break;
+			}
+		}
+	}
+
+	//Fail the pending transfers
+	for (auto &q : queues) {
+		for (auto &job : q) {
+			job.result.set_value(-ECANCELED);
+		}
+		q.clear();
+	}
+}
+
+void I2CScheduler::execute(Job &job, std::deque<Job> &queue) noexcept {
+	if (!job.messages) {
+		mutex.unlock();
+		auto rv = bus->access(job.address, job.readWrite, job.command,
+				job.size, job.data);
+		job.result.set_value((rv < 0) ? -errno : rv);
+		mutex.lock();
+		return;
+	}
+
+	//Merge the queued transfers to the same device (in order)
+	std::vector<Job> batch;
+	auto address = addressOf(job);
+	auto total = job.count;
+	try {
+		for (auto it = queue.begin(); address != NO_ADDRESS
+				&& it != queue.end();) {
+			if (addressOf(*it) != address) {
+				++it;
+			} else if (!it->messages
+					|| (total + it->count) > MAX_MESSAGES) {
+				break;
+			} else {
+				total += it->count;
+				batch.push_back(std::move(*it));
+				it = queue.erase(it);
+			}
+		}
+	} catch (...) {
+		//Proceed with the collected jobs
+	}
+
+	mutex.unlock();
+	struct i2c_msg messages[MAX_MESSAGES];
+	unsigned int count = 0;
+	for (unsigned int i = 0; i < job.count; ++i) {
+		messages[count++] = job.messages[i];
+	}
+	for (auto &j : batch) {
+		for (unsigned int i = 0; i < j.count; ++i) {
+			messages[count++] = j.messages[i];
+		}
+	}
+
+	auto rv = bus->transfer(messages, count);
+	auto error = (rv < 0) ? -errno : 0;
+	job.result.set_value(error ? error : (int) job.count);
+	for (auto &j : batch) {
+		j.result.set_value(error ? error : (int) j.count);
+	}
+	mutex.lock();
+}
+
+int I2CScheduler::wait(std::future<int> &&result) noexcept {
+	auto rv = result.get();
+	if (rv < 0) {
+		errno = -rv;
+		return -1;
+	} else {
+		return rv;
+	}
+}
+
+unsigned int I2CScheduler::addressOf(const Job &job) noexcept {
+	if (!job.messages) {
+		return job.address;
+	}
+
+	for (unsigned int i = 1; i < job.count; ++i) {
+		if (job.messages[i].addr != job.messages[0].addr) {
+			return NO_ADDRESS;
+		}
+	}
+	return job.messages[0].addr;
+}
+
+} /* namespace wanhive */
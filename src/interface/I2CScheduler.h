@@ -0,0 +1,126 @@
+/*
+ * I2CScheduler.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INTERFACE_I2CSCHEDULER_H_
+#define INTERFACE_I2CSCHEDULER_H_
+#include "I2CBus.h"
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace wanhive {
+/**
+ * Serializes the transfers of multiple devices sharing an I2C bus
+ * A single thread owns the underlying bus and services the queued transfers
+ * in the order of priority (FIFO within the same priority). Queued combined
+ * transfers to the same device are merged into a single combined transfer.
+ * The results are delivered through futures: a non-negative value on success
+ * and the negated errno on error.
+ */
+class I2CScheduler final: public I2CBus {
+public:
+	enum Priority {
+		CONTROL, /* Actuators (servo commands) */
+		STREAM, /* High rate sensors (FIFO reads) */
+		POLL, /* Slow sensors (environment) */
+		PRIORITIES
+	};
+
+	/*
+	 * Takes ownership of the <bus> and starts the bus thread
+	 */
+	I2CScheduler(I2CBus *bus);
+	~I2CScheduler();
+	/*
+	 * Synchronous access (priority: CONTROL)
+	 */
+	int access(unsigned int address, char readWrite, unsigned char command,
+			int size, union i2c_smbus_data *data) noexcept override;
+	int transfer(struct i2c_msg *messages, unsigned int count) noexcept
+			override;
+	/*
+	 * Asynchronous access, the <data> must remain valid until the result is
+	 * available.
+	 */
+	std::future<int> submit(Priority priority, unsigned int address,
+			char readWrite, unsigned char command, int size,
+			union i2c_smbus_data *data);
+	/*
+	 * Asynchronous combined transfer, the <messages> and their buffers must
+	 * remain valid until the result is available.
+	 */
+	std::future<int> submit(Priority priority, struct i2c_msg *messages,
+			unsigned int count);
+	/*
+	 * Returns a synchronous view of the scheduler with the given <priority>
+	 * (for the device drivers), owned by the scheduler.
+	 */
+	I2CBus* channel(Priority priority) noexcept;
+public:
+	//Maximum number of messages in a merged transfer
+	static constexpr unsigned int MAX_MESSAGES = 42;
+private:
+	struct Job {
+		struct i2c_msg *messages; //Combined transfer if not nullptr
+		unsigned int count;
+		unsigned int address;
+		char readWrite;
+		unsigned char command;
+		int size;
+		union i2c_smbus_data *data;
+		std::promise<int> result;
+	};
+
+	class Channel final: public I2CBus {
+	public:
+		int access(unsigned int address, char readWrite,
+				unsigned char command, int size,
+				union i2c_smbus_data *data) noexcept override;
+		int transfer(struct i2c_msg *messages, unsigned int count) noexcept
+				override;
+	private:
+		friend class I2CScheduler;
+		I2CScheduler *scheduler { nullptr };
+		Priority priority { CONTROL };
+	};
+
+	std::future<int> enqueue(Priority priority, Job &&job);
+	void work() noexcept;
+	//Executes the job (merged with the compatible queued jobs)
+	void execute(Job &job, std::deque<Job> &queue) noexcept;
+	static int wait(std::future<int> &&result) noexcept;
+	static unsigned int addressOf(const Job &job) noexcept;
+private:
+	I2CBus *bus;
+	Channel channels[PRIORITIES];
+	std::deque<Job> queues[PRIORITIES];
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::thread worker;
+	bool running;
+};
+
+} /* namespace wanhive */
+
+#endif /* INTERFACE_I2CSCHEDULER_H_ */
@@ -0,0 +1,516 @@
+/*
+ * I2CSimulator.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "I2CSimulator.h"
+#include <wanhive/wanhive-base.h>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+//PCA9685 registers
+constexpr unsigned char MODE1_REG = 0x00;
+constexpr unsigned char LAST_LED_REG = 0x45;
+constexpr unsigned char ALL_LED_ON_L = 0xFA;
+constexpr unsigned char PRESCALE_REG = 0xFE;
+constexpr unsigned char RESTART_MASK = 0x80;
+constexpr unsigned char AI_MASK = 0x20;
+constexpr unsigned char SLEEP_MASK = 0x10;
+
+//MPU6050 registers
+constexpr unsigned char SMPLRT_DIV_REG = 0x19;
+constexpr unsigned char CONFIG_REG = 0x1A;
+constexpr unsigned char GYRO_CONFIG_REG = 0x1B;
+constexpr unsigned char ACCEL_CONFIG_REG = 0x1C;
+constexpr unsigned char FIFO_EN_REG = 0x23;
+constexpr unsigned char INT_STATUS_REG = 0x3A;
+constexpr unsigned char USER_CTRL_REG = 0x6A;
+constexpr unsigned char PWR_MGMT_1_REG = 0x6B;
+constexpr unsigned char FIFO_COUNTH_REG = 0x72;
+constexpr unsigned char FIFO_R_W_REG = 0x74;
+constexpr unsigned char WHO_AM_I_REG = 0x75;
+constexpr unsigned char DEVICE_RESET_MASK = 0x80;
+constexpr unsigned char SLEEP_MODE_MASK = 0x40;
+constexpr unsigned char FIFO_ENABLE_MASK = 0x40;
+constexpr unsigned char FIFO_RESET_MASK = 0x04;
+constexpr unsigned char FIFO_OFLOW_MASK = 0x10;
+constexpr unsigned int FIFO_SIZE = 1024;
+
+//BME280 registers
+constexpr unsigned char BME_RESET_REG = 0xE0;
+constexpr unsigned char BME_CTRL_MEAS_REG = 0xF4;
+constexpr unsigned char BME_DATA_REG = 0xF7;
+constexpr unsigned char BME_RESET_COMMAND = 0xB6;
+//Calibration and raw measurements of the datasheet's example (+humidity)
+constexpr unsigned char BME_CALIB00[26] = { 0x70, 0x6B, 0x43, 0x67, 0x18, 0xFC,
+		0x7D, 0x8E, 0x43, 0xD6, 0xD0, 0x0B, 0x27, 0x0B, 0x8C, 0x00, 0xF9, 0xFF,
+		0x8C, 0x3C, 0xF8, 0xC6, 0x70, 0x17, 0x00, 0x4B };
+constexpr unsigned char BME_CALIB26[7] = { 0x6A, 0x01, 0x00, 0x13, 0x29,
+		0x03, 0x1E };
+constexpr unsigned char BME_MEASUREMENTS[8] = { 0x65, 0x59, 0xC0, 0x7E, 0xED,
+		0x00, 0x6E, 0x8F };
+constexpr unsigned char BME_SKIPPED[8] = { 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+		0x80, 0x00 };
+
+//Bytes traced per transfer
+constexpr unsigned int TRACE_BYTES = 16;
+
+unsigned long long now() noexcept {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//Sample rate of the MPU6050 in Hz
+double sampleRate(const unsigned char *registers) noexcept {
+	auto filter = registers[CONFIG_REG] & 0x07;
+	double output = (filter == 0 || filter == 7) ? 8000 : 1000;
+	return output / (1 + registers[SMPLRT_DIV_REG]);
+}
+
+//Bytes per FIFO sample (accelerometer, temperature, gyroscope axes)
+unsigned int sampleSize(const unsigned char *registers) noexcept {
+	auto enabled = registers[FIFO_EN_REG];
+	return ((enabled & 0x08) ? 6 : 0) + ((enabled & 0x80) ? 2 : 0)
+			+ ((enabled & 0x40) ? 2 : 0) + ((enabled & 0x20) ? 2 : 0)
+			+ ((enabled & 0x10) ? 2 : 0);
+}
+
+/**
+ * Generates the <index>th sample at <rate> Hz: ACCEL_XOUT_H to GYRO_ZOUT_L
+ * (14 bytes). The device rolls about the X axis by 10 degrees at 0.5 Hz.
+ */
+void synthesize(const unsigned char *registers, unsigned long long index,
+		double rate, unsigned char *sample) noexcept {
+	constexpr double PI = 3.14159265358979323846;
+	constexpr double AMPLITUDE = 10 * PI / 180;
+	constexpr double OMEGA = 2 * PI * 0.5;
+	auto t = index / rate;
+	auto roll = AMPLITUDE * sin(OMEGA * t);
+	auto rollRate = (AMPLITUDE * OMEGA * cos(OMEGA * t)) * 180 / PI;
+	//LSB per g and per degree/second at the configured full scale
+	auto accel = 16384.0 / (1 << ((registers[ACCEL_CONFIG_REG] >> 3) & 0x03));
+	auto gyro = 131.0 / (1 << ((registers[GYRO_CONFIG_REG] >> 3) & 0x03));
+	short values[7] = { 0, (short) lround(accel * sin(roll)), (short) lround(
+			accel * cos(roll)), -3920 /* 25 C */, (short) lround(
+			gyro * rollRate), 0, 0 };
+	for (unsigned int i = 0; i < 7; ++i) {
+		sample[2 * i] = ((unsigned short) values[i]) >> 8;
+		sample[2 * i + 1] = values[i] & 0xFF;
+	}
+}
+
+}  // namespace
+
+namespace wanhive {
+
+I2CSimulator::I2CSimulator(unsigned int clock, bool realTime) noexcept :
+		clock(clock ? clock : 100000), realTime(realTime), stream(nullptr) {
+	memset(devices, 0, sizeof(devices));
+	memset(&statistics, 0, sizeof(statistics));
+}
+
+I2CSimulator::~I2CSimulator() {
+
+}
+
+int I2CSimulator::access(unsigned int address, char readWrite,
+		unsigned char command, int size, union i2c_smbus_data *data) noexcept {
+	unsigned long long delay = 0;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto device = find(address);
+		if (!device) {
+			delay = account(1, 1);
+			errno = ENXIO;
+			return -1;
+		}
+
+		bool read = (readWrite == I2C_SMBUS_READ);
+		unsigned int length = 0;
+		switch (size) {
+		case I2C_SMBUS_QUICK:
+			delay = account(1, 1);
+			break;
+		case I2C_SMBUS_BYTE:
+			if (read) {
+				data->byte = load(*device);
+				delay = account(1, 2);
+			} else {
+				point(*device, command);
+				delay = account(1, 2);
+			}
+			break;
+		case I2C_SMBUS_BYTE_DATA:
+		case I2C_SMBUS_WORD_DATA:
+		case I2C_SMBUS_I2C_BLOCK_BROKEN:
+		case I2C_SMBUS_I2C_BLOCK_DATA:
+			if (size == I2C_SMBUS_BYTE_DATA) {
+				length = 1;
+			} else if (size == I2C_SMBUS_WORD_DATA) {
+				length = 2;
+			} else if (data->block[0] > I2C_SMBUS_BLOCK_MAX) {
+				errno = EINVAL;
+				return -1;
+			} else {
+				length = data->block[0];
+			}
+
+			{
+				//BYTE_DATA and WORD_DATA share the storage with the block
+				unsigned char buffer[I2C_SMBUS_BLOCK_MAX];
+				auto bytes = (size == I2C_SMBUS_BYTE_DATA) ? &data->byte :
+								(size == I2C_SMBUS_WORD_DATA) ? buffer :
+										data->block + 1;
+				point(*device, command);
+				if (read) {
+					for (unsigned int i = 0; i < length; ++i) {
+						bytes[i] = load(*device);
+					}
+					if (size == I2C_SMBUS_WORD_DATA) {
+						data->word = bytes[0] | (bytes[1] << 8);
+					}
+					//Write the address and the register, restart, read
+					delay = account(2, length + 3);
+				} else {
+					if (size == I2C_SMBUS_WORD_DATA) {
+						bytes[0] = data->word & 0xFF;
+						bytes[1] = data->word >> 8;
+					}
+					for (unsigned int i = 0; i < length; ++i) {
+						store(*device, bytes[i]);
+					}
+					delay = account(1, length + 2);
+				}
+				trace(address, read, command, bytes, length);
+			}
+			break;
+		default:
+			errno = EOPNOTSUPP;
+			return -1;
+		}
+	}
+
+	if (realTime && delay) {
+		std::this_thread::sleep_for(std::chrono::microseconds(delay));
+	}
+	return 0;
+}
+
+int I2CSimulator::transfer(struct i2c_msg *messages,
+		unsigned int count) noexcept {
+	unsigned long long delay = 0;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		unsigned int bytes = 0;
+		for (unsigned int i = 0; i < count; ++i) {
+			if (!find(messages[i].addr)) {
+				account(i + 1, bytes + 1);
+				errno = ENXIO;
+				return -1;
+			}
+			bytes += messages[i].len + 1;
+		}
+
+		for (unsigned int i = 0; i < count; ++i) {
+			auto &message = messages[i];
+			auto &device = *find(message.addr);
+			if (message.flags & I2C_M_RD) {
+				auto reg = device.pointer;
+				for (unsigned int j = 0; j < message.len; ++j) {
+					message.buf[j] = load(device);
+				}
+				trace(message.addr, true, reg, message.buf, message.len);
+			} else if (message.len) {
+				point(device, message.buf[0]);
+				for (unsigned int j = 1; j < message.len; ++j) {
+					store(device, message.buf[j]);
+				}
+				trace(message.addr, false, message.buf[0], message.buf + 1,
+						message.len - 1);
+			}
+		}
+		delay = account(count, bytes);
+	}
+
+	if (realTime && delay) {
+		std::this_thread::sleep_for(std::chrono::microseconds(delay));
+	}
+	return count;
+}
+
+void I2CSimulator::attach(unsigned int address, Model model) {
+	if (address >= MAX_DEVICES) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto &device = devices[address];
+	memset(&device, 0, sizeof(device));
+	device.model = model;
+	device.attached = true;
+	if (model == PCA9685) {
+		//Power-on state
+		device.registers[MODE1_REG] = 0x11;
+		device.registers[0x01] = 0x04; //MODE2
+		device.registers[0x02] = 0xE2; //SUBADR1
+		device.registers[0x03] = 0xE4; //SUBADR2
+		device.registers[0x04] = 0xE8; //SUBADR3
+		device.registers[0x05] = 0xE0; //ALLCALLADR
+		for (unsigned int reg = 0x09; reg <= LAST_LED_REG; reg += 4) {
+			device.registers[reg] = 0x10; //LEDX_OFF_H: full-off
+		}
+		device.registers[PRESCALE_REG] = 0x1E;
+	} else if (model == MPU6050) {
+		reset(device);
+	} else if (model == BME280) {
+		initialize(device);
+	}
+}
+
+unsigned char I2CSimulator::peek(unsigned int address, unsigned char reg) const {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (address >= MAX_DEVICES || !devices[address].attached) {
+		throw Exception(EX_PARAMETER);
+	}
+	return devices[address].registers[reg];
+}
+
+void I2CSimulator::setTrace(FILE *stream) noexcept {
+	std::lock_guard<std::mutex> lock(mutex);
+	this->stream = stream;
+}
+
+void I2CSimulator::getStatistics(Statistics &statistics, bool reset) noexcept {
+	std::lock_guard<std::mutex> lock(mutex);
+	statistics = this->statistics;
+	if (reset) {
+		memset(&this->statistics, 0, sizeof(this->statistics));
+	}
+}
+
+I2CSimulator::Device* I2CSimulator::find(unsigned int address) noexcept {
+	if (address < MAX_DEVICES && devices[address].attached) {
+		return &devices[address];
+	} else {
+		return nullptr;
+	}
+}
+
+void I2CSimulator::point(Device &device, unsigned char reg) noexcept {
+	device.pointer = reg;
+}
+
+void I2CSimulator::store(Device &device, unsigned char value) noexcept {
+	auto reg = device.pointer;
+	if (device.model == PCA9685) {
+		if (reg == MODE1_REG) {
+			//Writing one clears the RESTART bit
+			device.registers[reg] = value & ~RESTART_MASK;
+		} else if (reg >= ALL_LED_ON_L && reg < PRESCALE_REG) {
+			//ALL_LED registers update every channel, they read back as zero
+			for (unsigned int i = 0x06 + (reg - ALL_LED_ON_L);
+					i <= LAST_LED_REG; i += 4) {
+				device.registers[i] = value;
+			}
+		} else if (reg == PRESCALE_REG) {
+			//Writable only in the sleep mode
+			if (device.registers[MODE1_REG] & SLEEP_MASK) {
+				device.registers[reg] = value;
+			}
+		} else if (reg <= LAST_LED_REG) {
+			device.registers[reg] = value;
+		}
+	} else if (device.model == MPU6050) {
+		if (reg == PWR_MGMT_1_REG && (value & DEVICE_RESET_MASK)) {
+			reset(device);
+		} else if (reg == USER_CTRL_REG) {
+			//FIFO_RESET clears itself, the FIFO restarts when enabled
+			auto enabled = device.registers[reg] & FIFO_ENABLE_MASK;
+			device.registers[reg] = value & ~FIFO_RESET_MASK;
+			if ((value & FIFO_RESET_MASK)
+					|| ((value & FIFO_ENABLE_MASK) && !enabled)) {
+				restart(device);
+			}
+		} else if (reg == FIFO_R_W_REG) {
+			//Writes to the FIFO are ignored
+		} else if (reg != WHO_AM_I_REG && reg != INT_STATUS_REG) {
+			device.registers[reg] = value;
+		}
+	} else if (device.model == BME280) {
+		if (reg == BME_RESET_REG) {
+			if (value == BME_RESET_COMMAND) {
+				initialize(device);
+			}
+		} else if (reg >= 0xF2 && reg <= 0xF5) {
+			//Control registers, everything else is read-only
+			device.registers[reg] = value;
+			measure(device);
+		}
+	} else {
+		device.registers[reg] = value;
+	}
+	advance(device);
+}
+
+unsigned char I2CSimulator::load(Device &device) noexcept {
+	unsigned char value;
+	if (device.model != MPU6050) {
+		value = device.registers[device.pointer];
+	} else if (device.pointer == FIFO_R_W_REG) {
+		value = pop(device);
+	} else if (device.pointer == INT_STATUS_REG) {
+		//Cleared on read
+		level(device);
+		value = device.registers[INT_STATUS_REG];
+		device.registers[INT_STATUS_REG] = 0;
+	} else if (device.pointer == FIFO_COUNTH_REG) {
+		//Latches both the count registers
+		auto count = level(device);
+		device.registers[FIFO_COUNTH_REG + 1] = count & 0xFF;
+		value = count >> 8;
+	} else {
+		value = device.registers[device.pointer];
+	}
+	advance(device);
+	return value;
+}
+
+void I2CSimulator::advance(Device &device) noexcept {
+	if (device.model == MPU6050) {
+		//The burst reads of FIFO_R_W stay on the register
+		if (device.pointer != FIFO_R_W_REG) {
+			++device.pointer;
+		}
+	} else if (device.model != PCA9685) {
+		++device.pointer;
+	} else if (!(device.registers[MODE1_REG] & AI_MASK)) {
+		return;
+	} else if (device.pointer == LAST_LED_REG
+			|| device.pointer == PRESCALE_REG) {
+		device.pointer = 0;
+	} else {
+		++device.pointer;
+	}
+}
+
+void I2CSimulator::initialize(Device &device) noexcept {
+	memset(device.registers, 0, sizeof(device.registers));
+	memcpy(device.registers + 0x88, BME_CALIB00, sizeof(BME_CALIB00));
+	memcpy(device.registers + 0xE1, BME_CALIB26, sizeof(BME_CALIB26));
+	device.registers[0xD0] = 0x60; //Chip ID
+	measure(device);
+}
+
+void I2CSimulator::measure(Device &device) noexcept {
+	//Measuring unless in the sleep mode
+	auto measuring = (device.registers[BME_CTRL_MEAS_REG] & 0x03) != 0;
+	memcpy(device.registers + BME_DATA_REG,
+			(measuring ? BME_MEASUREMENTS : BME_SKIPPED), 8);
+}
+
+void I2CSimulator::reset(Device &device) noexcept {
+	memset(device.registers, 0, sizeof(device.registers));
+	device.registers[PWR_MGMT_1_REG] = SLEEP_MODE_MASK;
+	device.registers[WHO_AM_I_REG] = 0x68;
+	restart(device);
+}
+
+void I2CSimulator::restart(Device &device) noexcept {
+	device.fifo.origin = now();
+	device.fifo.read = 0;
+}
+
+unsigned long long I2CSimulator::level(Device &device) noexcept {
+	auto &registers = device.registers;
+	auto size = sampleSize(registers);
+	if (!(registers[USER_CTRL_REG] & FIFO_ENABLE_MASK)
+			|| (registers[PWR_MGMT_1_REG] & SLEEP_MODE_MASK) || !size) {
+		return 0;
+	}
+
+	auto samples = (unsigned long long) ((now() - device.fifo.origin)
+			* sampleRate(registers) / 1000000);
+	auto written = samples * size;
+	if (written - device.fifo.read > FIFO_SIZE) {
+		//The oldest bytes are overwritten
+		device.fifo.read = written - FIFO_SIZE;
+		registers[INT_STATUS_REG] |= FIFO_OFLOW_MASK;
+	}
+	return written - device.fifo.read;
+}
+
+unsigned char I2CSimulator::pop(Device &device) noexcept {
+	if (!level(device)) {
+		return 0;
+	}
+
+	auto &registers = device.registers;
+	auto size = sampleSize(registers);
+	auto position = device.fifo.read++;
+	unsigned char sample[14];
+	synthesize(registers, position / size, sampleRate(registers), sample);
+	//Pick the enabled sources (register order)
+	auto enabled = registers[FIFO_EN_REG];
+	unsigned int offset = position % size;
+	const unsigned char masks[] = { 0x08, 0x08, 0x08, 0x80, 0x40, 0x20, 0x10 };
+	for (unsigned int i = 0; i < 7; ++i) {
+		if (!(enabled & masks[i])) {
+			continue;
+		} else if (offset < 2) {
+			return sample[2 * i + offset];
+		} else {
+			offset -= 2;
+		}
+	}
+	return 0;
+}
+
+unsigned long long I2CSimulator::account(unsigned int messages,
+		unsigned int bytes) noexcept {
+	//Nine clocks per byte (ACK/NACK), about two per start/stop condition
+	auto time = ((bytes * 9ULL + messages * 2ULL) * 1000000 + clock - 1)
+			/ clock;
+	statistics.transfers += 1;
+	statistics.messages += messages;
+	statistics.bytes += bytes;
+	statistics.time += time;
+	return time;
+}
+
+void I2CSimulator::trace(unsigned int address, bool read, unsigned char reg,
+		const unsigned char *data, unsigned int length) noexcept {
+	if (!stream) {
+		return;
+	}
+
+	fprintf(stream, "I2C 0x%02X %c 0x%02X [%u]", address, (read ? 'R' : 'W'),
+			reg, length);
+	for (unsigned int i = 0; i < length && i < TRACE_BYTES; ++i) {
+		fprintf(stream, " %02X", data[i]);
+	}
+	fprintf(stream, "%s\n", (length > TRACE_BYTES) ? " ..." : "");
+}
+
+} /* namespace wanhive */
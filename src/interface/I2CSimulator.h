@@ -0,0 +1,128 @@
+/*
+ * I2CSimulator.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef INTERFACE_I2CSIMULATOR_H_
+#define INTERFACE_I2CSIMULATOR_H_
+#include "I2CBus.h"
+#include <cstdio>
+#include <mutex>
+
+namespace wanhive {
+/**
+ * Simulated I2C bus for testing and benchmarking the device drivers
+ * Devices are modelled as register files with auto-incrementing register
+ * pointers. The bus time of every transfer is computed from the bus clock
+ * (optionally the caller is delayed by the same amount), and the transfers
+ * can be traced to a stream. The MPU6050's FIFO fills up with synthetic
+ * samples (a slow roll oscillation) at the configured sample rate, the
+ * BME280 measures constant conditions (about 25 C, 1007 hPa and 46 %). Thread
+ * safe.
+ */
+class I2CSimulator final: public I2CBus {
+public:
+	enum Model {
+		GENERIC, /* 256 registers, pointer wraps around */
+		PCA9685, /* Power-on state, MODE1.AI, ALL_LED and PRESCALE behavior */
+		MPU6050, /* Power-on state, reset, FIFO (count, overflow and data) */
+		BME280 /* Chip ID, calibration, reset and the measurements */
+	};
+
+	struct Statistics {
+		unsigned long long transfers; //SMBus accesses and combined transfers
+		unsigned long long messages; //Messages (start conditions)
+		unsigned long long bytes; //Bytes on the bus including the addresses
+		unsigned long long time; //Bus time in microseconds
+	};
+
+	/*
+	 * <clock>: bus clock in Hz, <realTime>: delay the caller by the bus time
+	 */
+	I2CSimulator(unsigned int clock = 100000, bool realTime = false) noexcept;
+	~I2CSimulator();
+
+	int access(unsigned int address, char readWrite, unsigned char command,
+			int size, union i2c_smbus_data *data) noexcept override;
+	int transfer(struct i2c_msg *messages, unsigned int count) noexcept
+			override;
+
+	/*
+	 * Attaches a simulated device at the 7-bit <address>
+	 */
+	void attach(unsigned int address, Model model);
+	/*
+	 * Reads a register directly (not accounted)
+	 */
+	unsigned char peek(unsigned int address, unsigned char reg) const;
+	/*
+	 * Traces the transfers to the <stream> (nullptr disables tracing)
+	 */
+	void setTrace(FILE *stream) noexcept;
+	/*
+	 * Returns the statistics, optionally resets them
+	 */
+	void getStatistics(Statistics &statistics, bool reset = false) noexcept;
+public:
+	static constexpr unsigned int MAX_DEVICES = 128;
+private:
+	struct Device {
+		unsigned char registers[256];
+		unsigned char pointer;
+		Model model;
+		bool attached;
+		//FIFO of the MPU6050: start time (microseconds), bytes read since
+		struct {
+			unsigned long long origin;
+			unsigned long long read;
+		} fifo;
+	};
+
+	Device* find(unsigned int address) noexcept;
+	//Register pointer update
+	static void point(Device &device, unsigned char reg) noexcept;
+	static void store(Device &device, unsigned char value) noexcept;
+	static unsigned char load(Device &device) noexcept;
+	static void advance(Device &device) noexcept;
+	//MPU6050: power-on state, FIFO restart, FIFO level and data
+	static void reset(Device &device) noexcept;
+	static void restart(Device &device) noexcept;
+	static unsigned long long level(Device &device) noexcept;
+	static unsigned char pop(Device &device) noexcept;
+	//BME280: power-on state, data registers of the mode
+	static void initialize(Device &device) noexcept;
+	static void measure(Device &device) noexcept;
+	//Accounts for a transfer, returns the bus time in microseconds
+	unsigned long long account(unsigned int messages,
+			unsigned int bytes) noexcept;
+	void trace(unsigned int address, bool read, unsigned char reg,
+			const unsigned char *data, unsigned int length) noexcept;
+private:
+	Device devices[MAX_DEVICES];
+	Statistics statistics;
+	unsigned int clock;
+	bool realTime;
+	FILE *stream;
+	mutable std::mutex mutex;
+};
+
+} /* namespace wanhive */
+
+#endif /* INTERFACE_I2CSIMULATOR_H_ */
@@ -0,0 +1,130 @@
+/*
+ * JpegDecoder.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "JpegDecoder.h"
+#include <wanhive/wanhive-base.h>
+#include <csetjmp>
+#include <cstdio>
+extern "C" {
+#include <jpeglib.h>
+}
+
+namespace {
+/**
+ * Returns the control to the decoder instead of terminating the process
+ */
+struct ErrorManager {
+	jpeg_error_mgr pub;
+	jmp_buf env;
+};
+
+void onError(j_common_ptr cinfo) {
+	auto manager = (ErrorManager*) cinfo->err;
+	longjmp(manager->env, 1);
+}
+
+void onMessage(j_common_ptr cinfo) {
+	//Suppress the warnings
+}
+
+}  // namespace
+
+namespace wanhive {
+
+JpegDecoder::JpegDecoder() noexcept {
+
+}
+
+JpegDecoder::~JpegDecoder() {
+
+}
+
+void JpegDecoder::decode(const unsigned char *data, unsigned int size,
+		const cv::Size &target, cv::Mat &image) {
+	if (!data || !size) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	jpeg_decompress_struct cinfo;
+	ErrorManager manager;
+	cinfo.err = jpeg_std_error(&manager.pub);
+	manager.pub.error_exit = onError;
+	manager.pub.output_message = onMessage;
+	//No C++ object may be created between setjmp and longjmp
+	if (setjmp(manager.env)) {
+		jpeg_destroy_decompress(&cinfo);
+		throw Exception(EX_RESOURCE);
+	}
+
+	jpeg_create_decompress(&cinfo);
+	jpeg_mem_src(&cinfo, (unsigned char*) data, size);
+	jpeg_read_header(&cinfo, TRUE);
+
+	cinfo.scale_num = 1;
+	cinfo.scale_denom = scale(
+			cv::Size(cinfo.image_width, cinfo.image_height), target);
+	cinfo.dct_method = JDCT_ISLOW;
+#ifdef JCS_EXTENSIONS
+	cinfo.out_color_space = JCS_EXT_BGR;
+#else
+	cinfo.out_color_space = JCS_RGB;
+#endif
+	jpeg_start_decompress(&cinfo);
+
+	try {
+		image.create(cinfo.output_height, cinfo.output_width, CV_8UC3);
+	} catch (...) {
+		jpeg_destroy_decompress(&cinfo);
+		throw Exception(EX_MEMORY);
+	}
+
+	while (cinfo.output_scanline < cinfo.output_height) {
+		JSAMPROW row = image.ptr(cinfo.output_scanline);
+		jpeg_read_scanlines(&cinfo, &row, 1);
+	}
+	jpeg_finish_decompress(&cinfo);
+	jpeg_destroy_decompress(&cinfo);
+
+#ifndef JCS_EXTENSIONS
+	cv::cvtColor(image, image, cv::COLOR_RGB2BGR);
+#endif
+}
+
+unsigned int JpegDecoder::scale(const cv::Size &size,
+		const cv::Size &target) noexcept {
+	if (target.width <= 0 || target.height <= 0) {
+		return 1;
+	}
+
+	unsigned int denominator = 8;
+	for (; denominator > 1; denominator >>= 1) {
+		//libjpeg rounds the scaled dimensions up
+		auto width = (size.width + denominator - 1) / denominator;
+		auto height = (size.height + denominator - 1) / denominator;
+		if ((int) width >= target.width && (int) height >= target.height) {
+			break;
+		}
+	}
+	return denominator;
+}
+
+} /* namespace wanhive */
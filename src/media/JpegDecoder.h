@@ -0,0 +1,54 @@
+/*
+ * JpegDecoder.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEDIA_JPEGDECODER_H_
+#define MEDIA_JPEGDECODER_H_
+#include <opencv2/opencv.hpp>
+
+namespace wanhive {
+/**
+ * JPEG decoder with reduced-resolution output (uses libjpeg)
+ * Scaling down by 1/2, 1/4, or 1/8 inside the IDCT skips most of the work of
+ * a full-resolution decode followed by a resize.
+ */
+class JpegDecoder {
+public:
+	JpegDecoder() noexcept;
+	~JpegDecoder();
+	/*
+	 * Decodes a JPEG image into a BGR image at the smallest DCT scale which
+	 * is not smaller than the <target> size (full resolution if the target is
+	 * empty). Throws an exception on error.
+	 */
+	void decode(const unsigned char *data, unsigned int size,
+			const cv::Size &target, cv::Mat &image);
+	/*
+	 * Returns the largest scale denominator (1, 2, 4, or 8) that keeps the
+	 * image of the given <size> at least as large as the <target>.
+	 */
+	static unsigned int scale(const cv::Size &size,
+			const cv::Size &target) noexcept;
+};
+
+} /* namespace wanhive */
+
+#endif /* MEDIA_JPEGDECODER_H_ */
@@ -0,0 +1,231 @@
+/*
+ * Mosaic.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Mosaic.h"
+#include <wanhive/wanhive-base.h>
+
+namespace wanhive {
+
+Mosaic::Mosaic() noexcept :
+		columns(1), selected(0), updated(false), running(false) {
+}
+
+Mosaic::~Mosaic() {
+	stop();
+}
+
+void Mosaic::start(unsigned int tiles, const cv::Size &size,
+		unsigned int workers) {
+	stop();
+	if (!tiles || (tiles > 1 && !size.area())) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	try {
+		this->tiles.resize(tiles);
+		for (auto &t : this->tiles) {
+			t.count = 0;
+			t.changed = true;
+			t.pending = false;
+			t.busy = false;
+		}
+
+		this->size = size;
+		columns = (unsigned int) std::ceil(std::sqrt((double) tiles));
+		unsigned int rows = (tiles + columns - 1) / columns;
+		if (size.area()) {
+			image = cv::Mat::zeros(rows * size.height, columns * size.width,
+			CV_8UC3);
+		} else {
+			image.release();
+		}
+		selected = 0;
+		updated = false;
+
+		running = true;
+		workers = workers ? workers : 1;
+		for (unsigned int i = 0; i < workers; ++i) {
+			this->workers.emplace_back(&Mosaic::work, this);
+		}
+	} catch (BaseException &e) {
+		stop();
+		throw;
+	} catch (...) {
+		stop();
+		throw Exception(EX_RESOURCE);
+	}
+}
+
+void Mosaic::stop() noexcept {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	condition.notify_all();
+	for (auto &w : workers) {
+		w.join();
+	}
+	workers.clear();
+	tiles.clear();
+}
+
+void Mosaic::post(unsigned int tile, const unsigned char *data,
+		unsigned int size, const char *const*lines,
+		unsigned int count) noexcept {
+	try {
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!running || tile >= tiles.size() || !data || !size) {
+			return;
+		}
+
+		auto &t = tiles[tile];
+		t.jpeg.assign(data, data + size);
+		if (lines) {
+			t.count = Twiddler::min(count, MAX_LINES);
+			for (unsigned int i = 0; i < t.count; ++i) {
+				strncpy(t.lines[i], lines[i], sizeof(t.lines[i]) - 1);
+				t.lines[i][sizeof(t.lines[i]) - 1] = '\0';
+			}
+			t.changed = true;
+		}
+		t.pending = true;
+		lock.unlock();
+		condition.notify_one();
+	} catch (...) {
+		WH_LOG_EXCEPTION_U();
+	}
+}
+
+void Mosaic::select(unsigned int tile) noexcept {
+	std::lock_guard<std::mutex> lock(mutex);
+	selected = tile;
+}
+
+bool Mosaic::show(const char *window) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (!updated || image.empty()) {
+		return false;
+	} else {
+		cv::imshow(window, image);
+		updated = false;
+		return true;
+	}
+}
+
+bool Mosaic::isSingle() const noexcept {
+	return tiles.size() == 1;
+}
+
+void Mosaic::work() noexcept {
+	std::vector<unsigned char> jpeg;
+	char lines[MAX_LINES][Overlay::MAX_TEXT];
+	const char *captions[MAX_LINES];
+	for (unsigned int i = 0; i < MAX_LINES; ++i) {
+		captions[i] = lines[i];
+	}
+	unsigned int next = 0; //Round robin between the tiles
+	JpegDecoder decoder;
+	cv::Mat img;
+	while (true) {
+		std::unique_lock<std::mutex> lock(mutex);
+		unsigned int tile = tiles.size();
+		condition.wait(lock, [this, &tile, &next] {
+			if (!running) {
+				return true;
+			}
+			for (unsigned int i = 0; i < tiles.size(); ++i) {
+				auto k = (next + i) % tiles.size();
+				if (tiles[k].pending && !tiles[k].busy) {
+					tile = k;
+					return true;
+				}
+			}
+			return false;
+		});
+
+		if (!running) {
+			return;
+		}
+
+		auto &t = tiles[tile];
+		jpeg.swap(t.jpeg);
+		auto changed = t.changed;
+		if (changed) {
+			memcpy(lines, t.lines, sizeof(lines));
+		}
+		auto count = t.count;
+		auto highlight = (tiles.size() > 1 && tile == selected);
+		t.changed = false;
+		t.pending = false;
+		t.busy = true;
+		next = tile + 1;
+		lock.unlock();
+
+		try {
+			if (changed) {
+				t.overlay.update(captions, count);
+			}
+			render(decoder, jpeg, t.overlay, highlight, img);
+		} catch (...) {
+			img.release();
+			WH_LOG_DEBUG("Failed to decode the image");
+		}
+
+		lock.lock();
+		if (!img.empty()) {
+			if (tiles.size() == 1 && !size.area()) {
+				img.copyTo(image); //Takes the image's size
+			} else {
+				img.copyTo(image(locate(tile)));
+			}
+			updated = true;
+		}
+		t.busy = false;
+		lock.unlock();
+		condition.notify_one(); //Another image might be pending
+	}
+}
+
+void Mosaic::render(JpegDecoder &decoder,
+		const std::vector<unsigned char> &jpeg, const Overlay &overlay,
+		bool highlight, cv::Mat &img) {
+	//Decode at the smallest DCT scale covering the tile, then fit the tile
+	decoder.decode(jpeg.data(), jpeg.size(), size, img);
+	if (size.area() && img.size() != size) {
+		cv::Mat scaled;
+		cv::resize(img, scaled, size, 0, 0, cv::INTER_AREA);
+		img = scaled;
+	}
+
+	overlay.apply(img);
+	if (highlight) {
+		cv::rectangle(img, cv::Rect(0, 0, img.cols, img.rows),
+				cv::Scalar(0, 255, 255), 2);
+	}
+}
+
+cv::Rect Mosaic::locate(unsigned int tile) const noexcept {
+	return cv::Rect((tile % columns) * size.width,
+			(tile / columns) * size.height, size.width, size.height);
+}
+
+} /* namespace wanhive */
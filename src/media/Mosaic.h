@@ -0,0 +1,106 @@
+/*
+ * Mosaic.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEDIA_MOSAIC_H_
+#define MEDIA_MOSAIC_H_
+#include "JpegDecoder.h"
+#include "Overlay.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace wanhive {
+/**
+ * Composites multiple JPEG streams into a single image
+ * The images are decoded by a pool of worker threads, every tile keeps only
+ * the latest pending image (older ones are dropped). Images larger than the
+ * tile are decoded at a reduced resolution.
+ */
+class Mosaic {
+public:
+	Mosaic() noexcept;
+	~Mosaic();
+	/*
+	 * Lays out <tiles> tiles of the given <size> in a grid and starts <workers>
+	 * decoder threads. If a single tile of size zero is requested then the
+	 * mosaic takes the size of the decoded images.
+	 */
+	void start(unsigned int tiles, const cv::Size &size, unsigned int workers);
+	/*
+	 * Stops the decoder threads
+	 */
+	void stop() noexcept;
+	/*
+	 * Queues a JPEG image for the given <tile> along with the caption <lines>,
+	 * replaces the image waiting to be decoded. If <lines> is nullptr then the
+	 * tile keeps its current captions.
+	 */
+	void post(unsigned int tile, const unsigned char *data, unsigned int size,
+			const char *const*lines, unsigned int count) noexcept;
+	/*
+	 * Highlights the given tile
+	 */
+	void select(unsigned int tile) noexcept;
+	/*
+	 * Displays the mosaic in the named window if it was updated since the
+	 * last call. Returns true if the window was refreshed.
+	 */
+	bool show(const char *window);
+	/*
+	 * Returns true if the mosaic contains a single tile
+	 */
+	bool isSingle() const noexcept;
+public:
+	static constexpr unsigned int MAX_LINES = Overlay::MAX_LINES;
+private:
+	void work() noexcept;
+	void render(JpegDecoder &decoder, const std::vector<unsigned char> &jpeg,
+			const Overlay &overlay, bool highlight, cv::Mat &img);
+	cv::Rect locate(unsigned int tile) const noexcept;
+private:
+	struct Tile {
+		std::vector<unsigned char> jpeg; //Image waiting for the decoder
+		char lines[MAX_LINES][Overlay::MAX_TEXT]; //Captions
+		unsigned int count; //Number of captions
+		bool changed; //Captions changed
+		bool pending; //Image waiting for the decoder
+		bool busy; //Image being decoded
+		Overlay overlay; //Accessed only by the worker which holds the tile
+	};
+
+	std::vector<Tile> tiles;
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable condition;
+
+	cv::Mat image; //The mosaic
+	cv::Size size; //Tile size
+	unsigned int columns;
+	unsigned int selected;
+	bool updated;
+	bool running;
+};
+
+} /* namespace wanhive */
+
+#endif /* MEDIA_MOSAIC_H_ */
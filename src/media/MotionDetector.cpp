@@ -0,0 +1,167 @@
+/*
+ * MotionDetector.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "MotionDetector.h"
+#include <wanhive/wanhive-base.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace wanhive {
+
+MotionDetector::MotionDetector(const Settings &settings) noexcept :
+		settings(settings) {
+	this->settings.threshold = Twiddler::min(
+			Twiddler::max(settings.threshold, 1U), 254U);
+	this->settings.area = Twiddler::min(Twiddler::max(settings.area, 1U),
+			1000U);
+}
+
+MotionDetector::~MotionDetector() {
+
+}
+
+bool MotionDetector::detect(const cv::Mat &frame, Motion &motion) {
+	motion.area = 0;
+	motion.box = cv::Rect();
+	motion.detected = false;
+	if (frame.empty() || frame.type() != CV_8UC3) {
+		return false;
+	}
+
+	//Average down, then convert only the small image
+	auto height = Twiddler::max((frame.rows * WIDTH) / frame.cols, 1);
+	cv::resize(frame, scaled, cv::Size(WIDTH, height), 0, 0, cv::INTER_AREA);
+	cv::cvtColor(scaled, luma, cv::COLOR_BGR2GRAY);
+	if (background.size() != luma.size()) {
+		background = luma.clone();
+		return false;
+	}
+
+	mask.create(luma.size(), CV_8UC1);
+	auto pixels = (size_t) luma.rows * luma.cols;
+	auto changed = difference(luma.ptr(), background.ptr(), mask.ptr(), pixels,
+			settings.threshold);
+	motion.area = (changed * 1000) / pixels;
+	if (motion.area > GLOBAL_CHANGE) {
+		//The whole scene changed (exposure or the camera moved): start over
+		luma.copyTo(background);
+		motion.box = cv::Rect(0, 0, frame.cols, frame.rows);
+		motion.detected = true;
+		return true;
+	} else if (motion.area < settings.area) {
+		//No blob can be large enough
+		return false;
+	}
+
+	//Group the changed pixels into blobs, pick the largest one
+	if (kernel.empty()) {
+		kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3));
+	}
+	cv::dilate(mask, mask, kernel);
+	auto count = cv::connectedComponentsWithStats(mask, labels, stats,
+			centroids, 8, CV_32S);
+	int largest = 0;
+	for (int i = 1; i < count; ++i) {
+		if (!largest
+				|| stats.at<int>(i, cv::CC_STAT_AREA)
+						> stats.at<int>(largest, cv::CC_STAT_AREA)) {
+			largest = i;
+		}
+	}
+
+	if (!largest) {
+		return false;
+	}
+
+	auto area = (stats.at<int>(largest, cv::CC_STAT_AREA) * 1000) / pixels;
+	auto scale = (double) frame.cols / WIDTH;
+	motion.box.x = stats.at<int>(largest, cv::CC_STAT_LEFT) * scale;
+	motion.box.y = stats.at<int>(largest, cv::CC_STAT_TOP) * scale;
+	motion.box.width = stats.at<int>(largest, cv::CC_STAT_WIDTH) * scale;
+	motion.box.height = stats.at<int>(largest, cv::CC_STAT_HEIGHT) * scale;
+	motion.detected = (area >= settings.area);
+	return motion.detected;
+}
+
+void MotionDetector::reset() noexcept {
+	background.release();
+}
+
+size_t MotionDetector::difference(const unsigned char *frame,
+		unsigned char *background, unsigned char *mask, size_t count,
+		unsigned char threshold) noexcept {
+	size_t i = 0;
+	size_t changed = 0;
+#if defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i one = _mm_set1_epi8(1);
+	const __m128i limit = _mm_set1_epi8((char) threshold);
+	for (; i + 16 <= count; i += 16) {
+		auto f = _mm_loadu_si128((const __m128i*) (frame + i));
+		auto b = _mm_loadu_si128((const __m128i*) (background + i));
+		auto above = _mm_subs_epu8(f, b);
+		auto below = _mm_subs_epu8(b, f);
+		//|f - b| > threshold
+		auto m = _mm_cmpeq_epi8(
+				_mm_subs_epu8(_mm_or_si128(above, below), limit), zero);
+		m = _mm_andnot_si128(m, _mm_set1_epi8(-1));
+		_mm_storeu_si128((__m128i*) (mask + i), m);
+		changed += __builtin_popcount(_mm_movemask_epi8(m));
+
+		//One level toward the frame
+		b = _mm_subs_epu8(b, _mm_min_epu8(below, one));
+		b = _mm_adds_epu8(b, _mm_min_epu8(above, one));
+		_mm_storeu_si128((__m128i*) (background + i), b);
+	}
+#elif defined(__ARM_NEON)
+	auto sums = vdupq_n_u32(0);
+	const auto limit = vdupq_n_u8(threshold);
+	for (; i + 16 <= count; i += 16) {
+		auto f = vld1q_u8(frame + i);
+		auto b = vld1q_u8(background + i);
+		auto m = vcgtq_u8(vabdq_u8(f, b), limit);
+		vst1q_u8(mask + i, m);
+		sums = vpadalq_u16(sums, vpaddlq_u8(vshrq_n_u8(m, 7)));
+
+		//One level toward the frame (the comparisons yield -1)
+		b = vsubq_u8(b, vcgtq_u8(f, b));
+		b = vaddq_u8(b, vcltq_u8(f, b));
+		vst1q_u8(background + i, b);
+	}
+	changed = vgetq_lane_u32(sums, 0) + vgetq_lane_u32(sums, 1)
+			+ vgetq_lane_u32(sums, 2) + vgetq_lane_u32(sums, 3);
+#endif
+	for (; i < count; ++i) {
+		auto f = frame[i];
+		auto &b = background[i];
+		auto d = (f > b) ? (f - b) : (b - f);
+		mask[i] = (d > threshold) ? 255 : 0;
+		changed += (d > threshold);
+		b += (f > b) - (f < b);
+	}
+	return changed;
+}
+
+} /* namespace wanhive */
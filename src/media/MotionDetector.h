@@ -0,0 +1,85 @@
+/*
+ * MotionDetector.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEDIA_MOTIONDETECTOR_H_
+#define MEDIA_MOTIONDETECTOR_H_
+#include <opencv2/opencv.hpp>
+
+namespace wanhive {
+/**
+ * Motion detector working on the downscaled luma of the frames
+ * Every pixel is compared against a background which moves toward the frames
+ * by one level per frame (sigma-delta estimation), the changed pixels are
+ * grouped into blobs and the motion is reported if a blob is large enough.
+ */
+class MotionDetector {
+public:
+	struct Settings {
+		unsigned int threshold; //Minimum change of a pixel's luma
+		unsigned int area; //Minimum area of a blob (per mille of the frame)
+	};
+
+	struct Motion {
+		unsigned int area; //Changed pixels (per mille of the frame)
+		cv::Rect box; //Largest blob (in the frame's coordinates)
+		bool detected; //The largest blob is large enough
+	};
+public:
+	MotionDetector(const Settings &settings) noexcept;
+	~MotionDetector();
+	/*
+	 * Compares a BGR <frame> against the background and updates the
+	 * background. Returns true if motion is detected, the details are stored
+	 * into <motion>.
+	 */
+	bool detect(const cv::Mat &frame, Motion &motion);
+	//Forgets the background
+	void reset() noexcept;
+	/*
+	 * Differencing kernel: sets <mask> to 255 where the <frame> differs from
+	 * the <background> by more than the <threshold> (0 elsewhere) and moves
+	 * the <background> toward the <frame> by one level. Returns the number of
+	 * changed pixels.
+	 */
+	static size_t difference(const unsigned char *frame,
+			unsigned char *background, unsigned char *mask, size_t count,
+			unsigned char threshold) noexcept;
+public:
+	//Width of the downscaled luma (pixels)
+	static constexpr int WIDTH = 160;
+	//A change of more than half the frame (e.g. exposure) resets the background
+	static constexpr unsigned int GLOBAL_CHANGE = 500;
+private:
+	Settings settings;
+	cv::Mat scaled; //Downscaled frame (BGR)
+	cv::Mat luma;
+	cv::Mat background;
+	cv::Mat mask; //Changed pixels
+	cv::Mat kernel; //Joins the fragments of the blobs
+	cv::Mat labels;
+	cv::Mat stats;
+	cv::Mat centroids;
+};
+
+} /* namespace wanhive */
+
+#endif /* MEDIA_MOTIONDETECTOR_H_ */
@@ -0,0 +1,184 @@
+/*
+ * Overlay.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Overlay.h"
+#include <wanhive/wanhive-base.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+constexpr int FONT = cv::FONT_HERSHEY_COMPLEX_SMALL;
+constexpr double FONT_SCALE = 0.6;
+constexpr int LINE_SPACING = 20;
+//Baseline of the first line on the image
+constexpr int TEXT_X = 10;
+constexpr int TEXT_Y = 100;
+
+//Rounded x/255 for x in [0, 255 * 255]
+inline unsigned int div255(unsigned int x) {
+	x += 128;
+	return (x + (x >> 8)) >> 8;
+}
+
+}  // namespace
+
+namespace wanhive {
+
+Overlay::Overlay() noexcept :
+		lines(0) {
+	memset(text, 0, sizeof(text));
+}
+
+Overlay::~Overlay() {
+
+}
+
+void Overlay::update(const char *const*lines, unsigned int count) {
+	count = Twiddler::min(count, MAX_LINES);
+	bool changed = (count != this->lines);
+	for (unsigned int i = 0; !changed && i < count; ++i) {
+		changed = strncmp(text[i], lines[i], MAX_TEXT - 1);
+	}
+
+	if (!changed) {
+		return;
+	}
+
+	for (unsigned int i = 0; i < count; ++i) {
+		strncpy(text[i], lines[i], MAX_TEXT - 1);
+		text[i][MAX_TEXT - 1] = '\0';
+	}
+	this->lines = count;
+	render();
+}
+
+void Overlay::apply(cv::Mat &image) const noexcept {
+	if (sprite.empty() || image.empty() || image.type() != CV_8UC3) {
+		return;
+	}
+
+	//Clip the sprite
+	auto left = Twiddler::max(origin.x, 0);
+	auto top = Twiddler::max(origin.y, 0);
+	auto right = Twiddler::min(origin.x + sprite.cols, image.cols);
+	auto bottom = Twiddler::min(origin.y + sprite.rows, image.rows);
+	if (left >= right || top >= bottom) {
+		return;
+	}
+
+	auto offset = (left - origin.x) * 3;
+	size_t count = (right - left) * 3;
+	for (auto y = top; y < bottom; ++y) {
+		blend(color.ptr(y - origin.y) + offset,
+				inverse.ptr(y - origin.y) + offset, image.ptr(y) + left * 3,
+				count);
+	}
+}
+
+void Overlay::blend(const unsigned char *color, const unsigned char *inverse,
+		unsigned char *dst, size_t count) noexcept {
+	size_t i = 0;
+#if defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i half = _mm_set1_epi16(128);
+	for (; i + 16 <= count; i += 16) {
+		auto d = _mm_loadu_si128((const __m128i*) (dst + i));
+		auto a = _mm_loadu_si128((const __m128i*) (inverse + i));
+		auto c = _mm_loadu_si128((const __m128i*) (color + i));
+
+		auto lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero),
+				_mm_unpacklo_epi8(a, zero));
+		auto hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero),
+				_mm_unpackhi_epi8(a, zero));
+		lo = _mm_add_epi16(lo, half);
+		hi = _mm_add_epi16(hi, half);
+		lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+		hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+		auto r = _mm_adds_epu8(_mm_packus_epi16(lo, hi), c);
+		_mm_storeu_si128((__m128i*) (dst + i), r);
+	}
+#elif defined(__ARM_NEON)
+	for (; i + 8 <= count; i += 8) {
+		auto x = vmull_u8(vld1_u8(dst + i), vld1_u8(inverse + i));
+		//Rounded x/255: (x + ((x + 128) >> 8) + 128) >> 8
+		auto r = vraddhn_u16(x, vrshrq_n_u16(x, 8));
+		vst1_u8(dst + i, vqadd_u8(r, vld1_u8(color + i)));
+	}
+#endif
+	for (; i < count; ++i) {
+		auto v = color[i] + div255(dst[i] * inverse[i]);
+		dst[i] = (v > 255) ? 255 : v;
+	}
+}
+
+void Overlay::render() {
+	if (!lines) {
+		sprite.release();
+		color.release();
+		inverse.release();
+		return;
+	}
+
+	int width = 0;
+	int ascent = 0;
+	int descent = 0;
+	for (unsigned int i = 0; i < lines; ++i) {
+		int baseline = 0;
+		auto size = cv::getTextSize(text[i], FONT, FONT_SCALE, 1, &baseline);
+		width = Twiddler::max(width, size.width);
+		ascent = Twiddler::max(ascent, size.height);
+		descent = Twiddler::max(descent, baseline);
+	}
+
+	//One pixel of padding on every side
+	sprite = cv::Mat::zeros(ascent + descent + 2 + (lines - 1) * LINE_SPACING,
+			width + 2, CV_8UC4);
+	for (unsigned int i = 0; i < lines; ++i) {
+		cv::putText(sprite, text[i],
+				cv::Point(1, 1 + ascent + (int) i * LINE_SPACING), FONT,
+				FONT_SCALE,
+				(i ? cv::Scalar(0, 0, 255, 255) : cv::Scalar(225, 80, 80, 255)));
+	}
+	origin = cv::Point(TEXT_X - 1, TEXT_Y - ascent - 1);
+
+	//Split into the premultiplied colors and the inverse alpha
+	color.create(sprite.rows, sprite.cols, CV_8UC3);
+	inverse.create(sprite.rows, sprite.cols, CV_8UC3);
+	for (int y = 0; y < sprite.rows; ++y) {
+		auto s = sprite.ptr(y);
+		auto c = color.ptr(y);
+		auto a = inverse.ptr(y);
+		for (int x = 0; x < sprite.cols; ++x, s += 4, c += 3, a += 3) {
+			for (int k = 0; k < 3; ++k) {
+				c[k] = div255(s[k] * s[3]);
+				a[k] = 255 - s[3];
+			}
+		}
+	}
+}
+
+} /* namespace wanhive */
@@ -0,0 +1,71 @@
+/*
+ * Overlay.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEDIA_OVERLAY_H_
+#define MEDIA_OVERLAY_H_
+#include <opencv2/opencv.hpp>
+
+namespace wanhive {
+/**
+ * Text overlay rendered into a cached BGRA sprite
+ * The glyphs are rasterized only when the text changes, every frame just
+ * blends the sprite.
+ */
+class Overlay {
+public:
+	Overlay() noexcept;
+	~Overlay();
+	/*
+	 * Sets the text (one caption per line), re-renders the sprite only if the
+	 * text has changed.
+	 */
+	void update(const char *const*lines, unsigned int count);
+	/*
+	 * Blends the sprite onto a BGR image, the sprite is clipped to the
+	 * image's boundary.
+	 */
+	void apply(cv::Mat &image) const noexcept;
+	/*
+	 * Blending kernel: dst = color + dst * (255 - alpha) / 255, byte-wise.
+	 * <color> holds the premultiplied colors, <inverse> holds the inverse
+	 * alpha for each byte of <dst>.
+	 */
+	static void blend(const unsigned char *color, const unsigned char *inverse,
+			unsigned char *dst, size_t count) noexcept;
+public:
+	static constexpr unsigned int MAX_LINES = 4;
+	static constexpr unsigned int MAX_TEXT = 128;
+private:
+	void render();
+private:
+	char text[MAX_LINES][MAX_TEXT];
+	unsigned int lines;
+
+	cv::Mat sprite; //Rendered text (BGRA)
+	cv::Mat color; //Premultiplied colors (BGR)
+	cv::Mat inverse; //Inverse alpha of each color component
+	cv::Point origin; //Sprite's position on the image
+};
+
+} /* namespace wanhive */
+
+#endif /* MEDIA_OVERLAY_H_ */
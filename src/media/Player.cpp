@@ -0,0 +1,328 @@
+/*
+ * Player.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Player.h"
+#include <wanhive/wanhive-base.h>
+#include <chrono>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace {
+
+constexpr unsigned int SEEK_STEP = 60000; //Milliseconds
+
+}  // namespace
+
+namespace wanhive {
+
+Player::Player() noexcept {
+	name[0] = '\0';
+	title[0] = '\0';
+	segment.base = nullptr;
+	segment.length = 0;
+	segment.number = 0;
+	memset(&ctx, 0, sizeof(ctx));
+}
+
+Player::~Player() {
+	close();
+}
+
+void Player::open(const char *path) {
+	close();
+	auto length = path ? strlen(path) : 0;
+	if (length <= 4 || length >= sizeof(name)
+			|| strcmp(path + length - 4, ".idx")) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	index.open(path);
+	if (!index.size()) {
+		index.close();
+		throw Exception(EX_RESOURCE);
+	}
+
+	memcpy(name, path, length - 4);
+	name[length - 4] = '\0';
+	auto header = index.getHeader();
+	snprintf(title, sizeof(title), "Recording %llu [%u x %u] @%u frames/s",
+			(unsigned long long) header->source, header->width,
+			header->height, header->frameRate);
+
+	ctx.position = index.get(0)->timestamp;
+	ctx.speed = 1;
+	ctx.direction = 1;
+	ctx.paused = false;
+	ctx.frame = index.size(); //Nothing on the display yet
+}
+
+void Player::execute() {
+	if (!index.size()) {
+		throw Exception(EX_STATE);
+	}
+
+	auto header = index.getHeader();
+	int delay = header->frameRate ? (1000 / header->frameRate) : 40;
+	delay = delay ? delay : 1;
+	double first = index.get(0)->timestamp;
+	double last = index.get(index.size() - 1)->timestamp;
+
+	auto t = std::chrono::steady_clock::now();
+	while (true) {
+		auto now = std::chrono::steady_clock::now();
+		auto elapsed =
+				std::chrono::duration<double, std::milli>(now - t).count();
+		t = now;
+
+		if (!ctx.paused) {
+			ctx.position += elapsed * ctx.speed * ctx.direction;
+			//Pause on crossing the end in the direction of travel only
+			if (ctx.direction > 0 && ctx.position >= last) {
+				ctx.position = last;
+				ctx.paused = true;
+			} else if (ctx.direction < 0 && ctx.position <= first) {
+				ctx.position = first;
+				ctx.paused = true;
+			}
+
+			auto i = locate();
+			if (i != ctx.frame) {
+				show(i);
+			}
+			//Frames in between are skipped, read ahead only the next one
+			ctx.position += delay * ctx.speed * ctx.direction;
+			prefetch(locate());
+			ctx.position -= delay * ctx.speed * ctx.direction;
+		} else if (ctx.frame == index.size()) {
+			show(locate());
+		}
+
+		if (!processKeyPress(cv::waitKey(delay) & 0xFF)) {
+			break;
+		}
+	}
+
+	try {
+		cv::destroyWindow(title);
+	} catch (...) {
+	}
+}
+
+void Player::close() noexcept {
+	unmap();
+	index.close();
+	name[0] = '\0';
+	title[0] = '\0';
+	memset(&ctx, 0, sizeof(ctx));
+}
+
+unsigned long long Player::locate() const noexcept {
+	//The last frame captured at or before the current position
+	auto i = index.find((unsigned long long) ctx.position + 1);
+	return i ? (i - 1) : 0;
+}
+
+void Player::show(unsigned long long index) {
+	auto entry = this->index.get(index);
+	const unsigned char *data = nullptr;
+	if (!entry || !(data = fetch(entry))) {
+		return;
+	}
+
+	cv::Mat jpeg(1, entry->size, CV_8UC1, (void*) data);
+	cv::Mat img = cv::imdecode(jpeg, cv::IMREAD_COLOR);
+	if (img.empty()) {
+		return;
+	}
+
+	char text[128];
+	char t[32];
+	time_t seconds = entry->timestamp / 1000;
+	struct tm when;
+	gmtime_r(&seconds, &when);
+	strftime(t, sizeof(t), "%Y-%m-%dT%H:%M:%S", &when);
+	snprintf(text, sizeof(text), "%s.%03uZ  %ux %s", t,
+			(unsigned int) (entry->timestamp % 1000), ctx.speed,
+			(ctx.direction > 0 ? ">>" : "<<"));
+	cv::putText(img, text, cv::Point2f(10, 20), cv::FONT_HERSHEY_COMPLEX_SMALL,
+			0.6, cv::Scalar(225, 80, 80));
+	cv::imshow(title, img);
+	ctx.frame = index;
+}
+
+void Player::prefetch(unsigned long long index) noexcept {
+	auto entry = this->index.get(index);
+	if (!entry || index == ctx.frame || !segment.base
+			|| entry->segment != segment.number
+			|| (entry->offset + entry->size) > segment.length) {
+		return;
+	}
+
+	static const unsigned long pageSize = sysconf(_SC_PAGESIZE);
+	auto start = entry->offset & ~(pageSize - 1);
+	madvise((unsigned char*) segment.base + start,
+			entry->offset + entry->size - start, MADV_WILLNEED);
+}
+
+const unsigned char* Player::fetch(const RecordingEntry *entry) {
+	auto end = entry->offset + entry->size;
+	if (!segment.base || entry->segment != segment.number
+			|| end > segment.length) {
+		//Different segment or the segment has grown since the last mapping
+		map(entry->segment);
+	}
+
+	if (end <= segment.length) {
+		return (const unsigned char*) segment.base + entry->offset;
+	} else {
+		return nullptr;
+	}
+}
+
+void Player::map(unsigned int number) {
+	unmap();
+	char path[PATH_MAX];
+	if (!Recorder::segmentName(path, sizeof(path), name, number)) {
+		throw Exception(EX_PARAMETER);
+	}
+
+	auto fd = ::open(path, O_RDONLY);
+	if (fd == -1) {
+		throw SystemException();
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) == -1) {
+		::close(fd);
+		throw SystemException();
+	} else if (info.st_size == 0) {
+		::close(fd);
+		return;
+	}
+
+	auto p = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (p == MAP_FAILED) {
+		throw SystemException();
+	}
+
+	segment.base = p;
+	segment.length = info.st_size;
+	segment.number = number;
+	//Normal playback streams through the segment, fast playback hops
+	madvise(segment.base, segment.length,
+			(ctx.speed == 1 && ctx.direction > 0) ?
+					MADV_SEQUENTIAL : MADV_RANDOM);
+}
+
+void Player::unmap() noexcept {
+	if (segment.base) {
+		munmap(segment.base, segment.length);
+	}
+	segment.base = nullptr;
+	segment.length = 0;
+	segment.number = 0;
+}
+
+bool Player::processKeyPress(int keyCode) noexcept {
+	switch (keyCode) {
+	case 255:
+		return true;
+	case 'q': //Quit
+	case 'Q':
+	case 27:
+		return false;
+	case ' ': //Pause/Resume
+		ctx.paused = !ctx.paused;
+		return true;
+	case '+': //Faster
+	case '=':
+		ctx.speed = (ctx.speed < MAX_SPEED) ? (ctx.speed << 1) : MAX_SPEED;
+		break;
+	case '-': //Slower
+	case '_':
+		ctx.speed = (ctx.speed > 1) ? (ctx.speed >> 1) : 1;
+		break;
+	case 'r': //Reverse
+	case 'R':
+		ctx.direction = -ctx.direction;
+		break;
+	case '.': //Next frame
+	case '>':
+		step(1);
+		return true;
+	case ',': //Previous frame
+	case '<':
+		step(-1);
+		return true;
+	case ']': //Seek forward
+		seek(SEEK_STEP);
+		return true;
+	case '[': //Seek backward
+		seek(-(double) SEEK_STEP);
+		return true;
+	default:
+		return true;
+	}
+
+	//Speed or direction changed
+	if (segment.base) {
+		madvise(segment.base, segment.length,
+				(ctx.speed == 1 && ctx.direction > 0) ?
+						MADV_SEQUENTIAL : MADV_RANDOM);
+	}
+	return true;
+}
+
+void Player::seek(double offset) noexcept {
+	double first = index.get(0)->timestamp;
+	double last = index.get(index.size() - 1)->timestamp;
+	ctx.position += offset;
+	ctx.position = (ctx.position < first) ? first : ctx.position;
+	ctx.position = (ctx.position > last) ? last : ctx.position;
+	ctx.frame = index.size(); //Refresh the display
+}
+
+void Player::step(int direction) noexcept {
+	ctx.paused = true;
+	auto i = ctx.frame;
+	if (i >= index.size()) {
+		i = locate();
+	} else if (direction > 0 && (i + 1) < index.size()) {
+		++i;
+	} else if (direction < 0 && i > 0) {
+		--i;
+	} else {
+		return;
+	}
+
+	try {
+		ctx.position = index.get(i)->timestamp;
+		show(i);
+	} catch (BaseException &e) {
+		WH_LOG_EXCEPTION(e);
+	}
+}
+
+} /* namespace wanhive */
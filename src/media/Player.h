@@ -0,0 +1,96 @@
+/*
+ * Player.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEDIA_PLAYER_H_
+#define MEDIA_PLAYER_H_
+#include "RecordingIndex.h"
+#include <opencv2/opencv.hpp>
+
+namespace wanhive {
+/**
+ * Memory mapped playback of the indexed recordings
+ * Only the frames due for display are decoded, hence the cost of playback
+ * doesn't grow with the speed.
+ */
+class Player {
+public:
+	Player() noexcept;
+	~Player();
+	/*
+	 * Opens the recording described by the index file at <path>
+	 */
+	void open(const char *path);
+	/*
+	 * Plays the recording in a desktop window until the user quits
+	 */
+	void execute();
+	/*
+	 * Closes the recording
+	 */
+	void close() noexcept;
+private:
+	//Returns the frame due for display at the current position
+	unsigned long long locate() const noexcept;
+	//Decodes and displays the frame at the given position
+	void show(unsigned long long index);
+	//Reads ahead the frame at the given position
+	void prefetch(unsigned long long index) noexcept;
+	//Returns the mapped frame at the given position
+	const unsigned char* fetch(const RecordingEntry *entry);
+	//Maps a segment into the memory
+	void map(unsigned int segment);
+	void unmap() noexcept;
+	//Process keyboard inputs, returns false to quit
+	bool processKeyPress(int keyCode) noexcept;
+	//Moves the position by <offset> milliseconds
+	void seek(double offset) noexcept;
+	//Moves to the adjacent frame and pauses
+	void step(int direction) noexcept;
+public:
+	static constexpr unsigned int MAX_SPEED = 64;
+private:
+	RecordingIndex index;
+	char name[4096]; //Recording's name (index path without extension)
+	char title[256]; //Window name
+
+	struct {
+		void *base;
+		size_t length;
+		unsigned int number;
+	} segment;
+
+	struct {
+		//Current position (milliseconds since the epoch)
+		double position;
+		//Playback speed [1, MAX_SPEED]
+		unsigned int speed;
+		//Playback direction (-1 or 1)
+		int direction;
+		bool paused;
+		//Position of the frame on the display
+		unsigned long long frame;
+	} ctx;
+};
+
+} /* namespace wanhive */
+
+#endif /* MEDIA_PLAYER_H_ */
@@ -0,0 +1,193 @@
+/*
+ * Recorder.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Recorder.h"
+#include <wanhive/wanhive-base.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace wanhive {
+
+Recorder::Recorder() noexcept :
+		indexFd(-1), timestamp(0) {
+	limits.duration = 0;
+	limits.size = 0;
+	segment.fd = -1;
+	segment.number = 0;
+	segment.start = 0;
+	segment.bytes = 0;
+	name[0] = '\0';
+}
+
+Recorder::~Recorder() {
+	close();
+}
+
+void Recorder::setLimits(unsigned int duration,
+		unsigned long long size) noexcept {
+	limits.duration = duration * 1000ULL;
+	limits.size = size;
+}
+
+void Recorder::open(const char *name, const RecordingHeader &header) {
+	static_assert(sizeof(RecordingHeader) == 32, "Invalid header size");
+	static_assert(sizeof(RecordingEntry) == 24, "Invalid entry size");
+	try {
+		close(); //Just in case
+		if (!name || strlen(name) >= sizeof(this->name)) {
+			throw Exception(EX_PARAMETER);
+		}
+		strcpy(this->name, name);
+
+		char path[PATH_MAX];
+		if (!indexName(path, sizeof(path), name)) {
+			throw Exception(EX_PARAMETER);
+		} else if ((indexFd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC,
+				0644)) == -1) {
+			throw SystemException();
+		}
+
+		auto h = header;
+		h.magic = MAGIC;
+		h.version = VERSION;
+		h.reserved = 0;
+		writeAll(indexFd, &h, sizeof(h));
+		segment.number = 0;
+		timestamp = 0;
+	} catch (BaseException &e) {
+		close();
+		throw;
+	}
+}
+
+void Recorder::write(const unsigned char *data, unsigned int size,
+		unsigned long long timestamp) {
+	if (!isOpen()) {
+		throw Exception(EX_STATE);
+	} else if (!data || !size) {
+		return;
+	}
+
+	//The index must remain sorted by time
+	timestamp = (timestamp > this->timestamp) ? timestamp : this->timestamp;
+	if (segment.fd != -1 && segmentFull(size, timestamp)) {
+		closeSegment();
+		++segment.number;
+	}
+
+	if (segment.fd == -1) {
+		openSegment();
+		segment.start = timestamp;
+	}
+
+	RecordingEntry entry;
+	entry.timestamp = timestamp;
+	entry.offset = segment.bytes;
+	entry.size = size;
+	entry.segment = segment.number;
+
+	//Frame data first, the index never points past the written data
+	writeAll(segment.fd, data, size);
+	segment.bytes += size;
+	writeAll(indexFd, &entry, sizeof(entry));
+	this->timestamp = timestamp;
+}
+
+void Recorder::close() noexcept {
+	closeSegment();
+	if (indexFd != -1) {
+		::close(indexFd);
+	}
+	indexFd = -1;
+	name[0] = '\0';
+}
+
+bool Recorder::isOpen() const noexcept {
+	return indexFd != -1;
+}
+
+bool Recorder::segmentName(char *buffer, size_t size, const char *name,
+		unsigned int segment) noexcept {
+	auto n = snprintf(buffer, size, "%s-s%04u.mjpeg", name, segment);
+	return n > 0 && (size_t) n < size;
+}
+
+bool Recorder::indexName(char *buffer, size_t size, const char *name) noexcept {
+	auto n = snprintf(buffer, size, "%s.idx", name);
+	return n > 0 && (size_t) n < size;
+}
+
+void Recorder::openSegment() {
+	char path[PATH_MAX];
+	if (!segmentName(path, sizeof(path), name, segment.number)) {
+		throw Exception(EX_PARAMETER);
+	} else if ((segment.fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644))
+			== -1) {
+		throw SystemException();
+	} else {
+		segment.bytes = 0;
+	}
+}
+
+void Recorder::closeSegment() noexcept {
+	if (segment.fd == -1) {
+		return;
+	}
+
+	//Make the segment and its index entries durable
+	fsync(segment.fd);
+	::close(segment.fd);
+	segment.fd = -1;
+	segment.bytes = 0;
+	if (indexFd != -1) {
+		fsync(indexFd);
+	}
+}
+
+bool Recorder::segmentFull(unsigned int size,
+		unsigned long long timestamp) const noexcept {
+	if (limits.duration && (timestamp - segment.start) >= limits.duration) {
+		return true;
+	} else if (limits.size && segment.bytes
+			&& (segment.bytes + size) > limits.size) {
+		return true;
+	} else {
+		return false;
+	}
+}
+
+void Recorder::writeAll(int fd, const void *buffer, size_t count) {
+	auto p = (const unsigned char*) buffer;
+	while (count) {
+		auto n = ::write(fd, p, count);
+		if (n == -1 && errno == EINTR) {
+			continue;
+		} else if (n <= 0) {
+			throw SystemException();
+		} else {
+			p += n;
+			count -= n;
+		}
+	}
+}
+
+} /* namespace wanhive */
@@ -0,0 +1,125 @@
+/*
+ * Recorder.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEDIA_RECORDER_H_
+#define MEDIA_RECORDER_H_
+#include <cstddef>
+#include <cstdint>
+
+namespace wanhive {
+/**
+ * Header of a recording's index file
+ */
+struct RecordingHeader {
+	uint32_t magic; //Always Recorder::MAGIC
+	uint32_t version; //Always Recorder::VERSION
+	uint64_t source; //Identifier of the stream's source
+	uint32_t width; //Frame width
+	uint32_t height; //Frame height
+	uint32_t frameRate; //Frame rate reported by the source
+	uint32_t reserved; //Padding
+};
+/**
+ * Index entry of a recorded frame
+ */
+struct RecordingEntry {
+	uint64_t timestamp; //Capture time (milliseconds since the epoch)
+	uint64_t offset; //Frame's offset inside the segment
+	uint32_t size; //Frame's size in bytes
+	uint32_t segment; //Segment number (starts at 0)
+};
+
+/**
+ * Segmented JPEG stream recorder
+ * A recording is a sequence of rolling MJPEG segments bounded by duration and
+ * size, plus a sidecar index of fixed-size entries (see RecordingIndex).
+ */
+class Recorder {
+public:
+	Recorder() noexcept;
+	~Recorder();
+	/*
+	 * Sets the segment limits: <duration> in seconds, <size> in bytes.
+	 * Zero means unlimited.
+	 */
+	void setLimits(unsigned int duration, unsigned long long size) noexcept;
+	/*
+	 * Starts a new recording. <name> is the common prefix of the index file
+	 * and the segments (closes the current recording).
+	 */
+	void open(const char *name, const RecordingHeader &header);
+	/*
+	 * Appends a JPEG frame captured at <timestamp> (milliseconds since the
+	 * epoch), starts a new segment whenever a limit is exceeded. A timestamp
+	 * earlier than the previous frame's is raised to it (the index remains
+	 * sorted by time).
+	 */
+	void write(const unsigned char *data, unsigned int size,
+			unsigned long long timestamp);
+	/*
+	 * Finalizes the current segment and closes the recording.
+	 */
+	void close() noexcept;
+	/*
+	 * Returns true if a recording is in progress.
+	 */
+	bool isOpen() const noexcept;
+	/*
+	 * Generates the pathname of a segment from the recording's <name>.
+	 * Returns true on success, false if the buffer is too small.
+	 */
+	static bool segmentName(char *buffer, size_t size, const char *name,
+			unsigned int segment) noexcept;
+	/*
+	 * Generates the pathname of the index file from the recording's <name>.
+	 * Returns true on success, false if the buffer is too small.
+	 */
+	static bool indexName(char *buffer, size_t size, const char *name) noexcept;
+private:
+	void openSegment();
+	void closeSegment() noexcept;
+	bool segmentFull(unsigned int size, unsigned long long timestamp) const noexcept;
+	static void writeAll(int fd, const void *buffer, size_t count);
+public:
+	static constexpr uint32_t MAGIC = 0x49524857; //"WHRI"
+	static constexpr uint32_t VERSION = 1;
+private:
+	struct {
+		unsigned long long duration; //Segment duration in milliseconds
+		unsigned long long size; //Segment size in bytes
+	} limits;
+
+	struct {
+		int fd;
+		unsigned int number; //Current segment's number
+		unsigned long long start; //Timestamp of the segment's first frame
+		unsigned long long bytes; //Bytes written into the segment
+	} segment;
+
+	int indexFd;
+	unsigned long long timestamp; //Timestamp of the last frame
+	char name[4096];
+};
+
+} /* namespace wanhive */
+
+#endif /* MEDIA_RECORDER_H_ */
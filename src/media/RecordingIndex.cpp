@@ -0,0 +1,117 @@
+/*
+ * RecordingIndex.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "RecordingIndex.h"
+#include <wanhive/wanhive-base.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace wanhive {
+
+RecordingIndex::RecordingIndex() noexcept :
+		base(nullptr), length(0), entries(nullptr), count(0) {
+}
+
+RecordingIndex::~RecordingIndex() {
+	close();
+}
+
+void RecordingIndex::open(const char *path) {
+	close();
+	auto fd = ::open(path, O_RDONLY);
+	if (fd == -1) {
+		throw SystemException();
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) == -1) {
+		::close(fd);
+		throw SystemException();
+	} else if ((size_t) info.st_size < sizeof(RecordingHeader)) {
+		::close(fd);
+		throw Exception(EX_RESOURCE);
+	}
+
+	auto p = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (p == MAP_FAILED) {
+		throw SystemException();
+	}
+
+	base = p;
+	length = info.st_size;
+	auto header = (const RecordingHeader*) base;
+	if (header->magic != Recorder::MAGIC
+			|| header->version != Recorder::VERSION) {
+		close();
+		throw Exception(EX_RESOURCE);
+	}
+
+	entries = (const RecordingEntry*) ((const unsigned char*) base
+			+ sizeof(RecordingHeader));
+	count = (length - sizeof(RecordingHeader)) / sizeof(RecordingEntry);
+	//Binary search touches the pages randomly
+	madvise(base, length, MADV_RANDOM);
+}
+
+void RecordingIndex::close() noexcept {
+	if (base) {
+		munmap(base, length);
+	}
+	base = nullptr;
+	length = 0;
+	entries = nullptr;
+	count = 0;
+}
+
+const RecordingHeader* RecordingIndex::getHeader() const noexcept {
+	return (const RecordingHeader*) base;
+}
+
+unsigned long long RecordingIndex::size() const noexcept {
+	return count;
+}
+
+const RecordingEntry* RecordingIndex::get(
+		unsigned long long index) const noexcept {
+	return (index < count) ? (entries + index) : nullptr;
+}
+
+unsigned long long RecordingIndex::find(
+		unsigned long long timestamp) const noexcept {
+	//Entries are sorted by timestamp (lower bound)
+	unsigned long long low = 0;
+	unsigned long long high = count;
+	while (low < high) {
+		auto mid = low + (high - low) / 2;
+		if (entries[mid].timestamp < timestamp) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
+} /* namespace wanhive */
@@ -0,0 +1,71 @@
+/*
+ * RecordingIndex.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEDIA_RECORDINGINDEX_H_
+#define MEDIA_RECORDINGINDEX_H_
+#include "Recorder.h"
+
+namespace wanhive {
+/**
+ * Read-only (memory mapped) view of a recording's index
+ */
+class RecordingIndex {
+public:
+	RecordingIndex() noexcept;
+	~RecordingIndex();
+	/*
+	 * Maps the index file at <path> (closes the current index). A trailing
+	 * partial entry, left behind by a crash, is ignored.
+	 */
+	void open(const char *path);
+	/*
+	 * Unmaps the index file
+	 */
+	void close() noexcept;
+	/*
+	 * Returns the recording's header (nullptr if no index is open)
+	 */
+	const RecordingHeader* getHeader() const noexcept;
+	/*
+	 * Returns the number of indexed frames
+	 */
+	unsigned long long size() const noexcept;
+	/*
+	 * Returns the entry at the given <index> (nullptr if out of range)
+	 */
+	const RecordingEntry* get(unsigned long long index) const noexcept;
+	/*
+	 * Returns the position of the first frame captured at or after the given
+	 * <timestamp> (milliseconds since the epoch) in O(log n) time. Returns
+	 * size() if no such frame exists.
+	 */
+	unsigned long long find(unsigned long long timestamp) const noexcept;
+private:
+	void *base;
+	size_t length;
+	const RecordingEntry *entries;
+	unsigned long long count;
+};
+
+} /* namespace wanhive */
+
+#endif /* MEDIA_RECORDINGINDEX_H_ */
@@ -0,0 +1,250 @@
+/*
+ * Stabilizer.cpp
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Stabilizer.h"
+#include <wanhive/wanhive-base.h>
+#include <cmath>
+
+namespace {
+
+//Longest gap in the angular rates bridged by the integration (seconds)
+constexpr double MAX_GAP = 0.1;
+
+inline double clamp(double value, double limit) noexcept {
+	return (value > limit) ? limit : ((value < -limit) ? -limit : value);
+}
+
+}  // namespace
+
+namespace wanhive {
+
+Stabilizer::Stabilizer(const Settings &settings) noexcept :
+		settings(settings), uses(0) {
+	this->settings.crop = Twiddler::min(Twiddler::max(settings.crop, 50U),
+			100U);
+	this->settings.fov = Twiddler::min(Twiddler::max(settings.fov, 10U),
+			170U);
+	geometry.focal = 0;
+	geometry.roll = 0;
+	for (auto &entry : cache) {
+		entry.index = 0;
+		entry.used = 0;
+	}
+	reset();
+}
+
+Stabilizer::~Stabilizer() {
+
+}
+
+void Stabilizer::rotate(double timestamp, const double rates[3]) noexcept {
+	auto &entry = history[head];
+	if (!size) {
+		entry.angles[0] = entry.angles[1] = entry.angles[2] = 0;
+	} else {
+		auto &last = history[(head + HISTORY - 1) % HISTORY];
+		auto dt = timestamp - last.timestamp;
+		if (dt <= 0) {
+			return;
+		}
+
+		dt = Twiddler::min(dt, MAX_GAP);
+		for (unsigned int i = 0; i < 3; ++i) {
+			entry.angles[i] = last.angles[i] + rates[i] * dt;
+		}
+	}
+
+	entry.timestamp = timestamp;
+	head = (head + 1) % HISTORY;
+	size = Twiddler::min(size + 1, HISTORY);
+}
+
+const cv::Mat& Stabilizer::apply(const cv::Mat &frame, double timestamp) {
+	if (frame.empty()) {
+		return frame;
+	} else if (frame.cols != geometry.frame.width
+			|| frame.rows != geometry.frame.height) {
+		resize(frame.cols, frame.rows);
+	}
+
+	double angles[3];
+	locate(timestamp, angles);
+	//Low-pass filter the orientation
+	auto alpha = 1.0;
+	if (path.timestamp && settings.smoothing) {
+		auto dt = Twiddler::max(timestamp - path.timestamp, 0.0);
+		alpha = 1 - exp(-dt * 1000 / settings.smoothing);
+	}
+	for (unsigned int i = 0; i < 3; ++i) {
+		path.angles[i] += alpha * (angles[i] - path.angles[i]);
+	}
+	path.timestamp = timestamp;
+
+	//The roll takes its share of the margins, the shifts take the rest
+	auto roll = clamp(path.angles[2] - angles[2], geometry.roll);
+	auto index = (int) lround(roll * 180 / (M_PI * ROLL_STEP));
+	auto quantized = index * ROLL_STEP * M_PI / 180;
+	auto c = cos(quantized);
+	auto s = fabs(sin(quantized));
+	auto &crop = geometry.crop;
+	auto &bounds = geometry.frame;
+	auto marginX = Twiddler::max(
+			(bounds.width - crop.width * c - crop.height * s) / 2 - 1, 0.0);
+	auto marginY = Twiddler::max(
+			(bounds.height - crop.width * s - crop.height * c) / 2 - 1, 0.0);
+	//Yaw shifts the window horizontally, pitch vertically
+	auto dx = clamp(geometry.focal * (path.angles[1] - angles[1]), marginX);
+	auto dy = clamp(geometry.focal * (angles[0] - path.angles[0]), marginY);
+
+	//Don't let the path drift beyond the margins
+	path.angles[0] = angles[0] - dy / geometry.focal;
+	path.angles[1] = angles[1] + dx / geometry.focal;
+	path.angles[2] = angles[2] + roll;
+
+	auto cx = bounds.width / 2.0 + dx;
+	auto cy = bounds.height / 2.0 + dy;
+	if (!index) {
+		auto x = Twiddler::min(Twiddler::max(lround(cx - crop.width / 2.0), 0L),
+				(long) (bounds.width - crop.width));
+		auto y = Twiddler::min(
+				Twiddler::max(lround(cy - crop.height / 2.0), 0L),
+				(long) (bounds.height - crop.height));
+		roi = frame(cv::Rect(x, y, crop.width, crop.height));
+		return roi;
+	}
+
+	auto &entry = cache[lookup(index)];
+	auto &window = entry.window;
+	auto x = Twiddler::min(Twiddler::max(lround(cx - window.width / 2.0), 0L),
+			(long) (bounds.width - window.width));
+	auto y = Twiddler::min(Twiddler::max(lround(cy - window.height / 2.0), 0L),
+			(long) (bounds.height - window.height));
+	cv::remap(frame(cv::Rect(x, y, window.width, window.height)), image,
+			entry.map1, entry.map2, cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+	return image;
+}
+
+void Stabilizer::reset() noexcept {
+	memset(history, 0, sizeof(history));
+	head = 0;
+	size = 0;
+	memset(&path, 0, sizeof(path));
+}
+
+void Stabilizer::locate(double timestamp, double angles[3]) const noexcept {
+	if (!size) {
+		angles[0] = angles[1] = angles[2] = 0;
+		return;
+	}
+
+	//Walk back from the latest entry, the frames are recent
+	auto newer = &history[(head + HISTORY - 1) % HISTORY];
+	if (timestamp >= newer->timestamp) {
+		memcpy(angles, newer->angles, sizeof(newer->angles));
+		return;
+	}
+
+	for (unsigned int i = 2; i <= size; ++i) {
+		auto &older = history[(head + HISTORY - i) % HISTORY];
+		if (older.timestamp <= timestamp) {
+			auto t = (timestamp - older.timestamp)
+					/ (newer->timestamp - older.timestamp);
+			for (unsigned int j = 0; j < 3; ++j) {
+				angles[j] = older.angles[j]
+						+ t * (newer->angles[j] - older.angles[j]);
+			}
+			return;
+		}
+		newer = &older;
+	}
+
+	//Older than the history
+	memcpy(angles, newer->angles, sizeof(newer->angles));
+}
+
+void Stabilizer::resize(int width, int height) noexcept {
+	geometry.frame = cv::Size(width, height);
+	geometry.crop.width = Twiddler::max(
+			(int) (width * settings.crop / 100) & ~1, 2);
+	geometry.crop.height = Twiddler::max(
+			(int) (height * settings.crop / 100) & ~1, 2);
+	geometry.focal = (width / 2.0) / tan(settings.fov * M_PI / 360);
+	//At most half of the margins go to the roll correction
+	auto marginX = (width - geometry.crop.width) / 2.0;
+	auto marginY = (height - geometry.crop.height) / 2.0;
+	geometry.roll = asin(
+			Twiddler::min(
+					Twiddler::min(marginX / geometry.crop.height,
+							marginY / geometry.crop.width), 1.0));
+
+	for (auto &entry : cache) {
+		entry.map1.release();
+		entry.map2.release();
+		entry.used = 0;
+	}
+}
+
+unsigned int Stabilizer::lookup(int index) {
+	unsigned int slot = 0;
+	for (unsigned int i = 0; i < CACHE_SIZE; ++i) {
+		if (cache[i].used && cache[i].index == index) {
+			cache[i].used = ++uses;
+			return i;
+		} else if (cache[i].used < cache[slot].used) {
+			slot = i;
+		}
+	}
+
+	//Replace the least recently used tables
+	auto &entry = cache[slot];
+	auto roll = index * ROLL_STEP * M_PI / 180;
+	auto c = cos(roll);
+	auto s = sin(roll);
+	auto &crop = geometry.crop;
+	entry.window.width = Twiddler::min(
+			(int) ceil(crop.width * c + crop.height * fabs(s)) + 2,
+			geometry.frame.width);
+	entry.window.height = Twiddler::min(
+			(int) ceil(crop.width * fabs(s) + crop.height * c) + 2,
+			geometry.frame.height);
+
+	//Rotate the crop window about its center
+	cv::Mat map(crop, CV_32FC2);
+	auto u0 = (crop.width - 1) / 2.0;
+	auto v0 = (crop.height - 1) / 2.0;
+	auto x0 = (entry.window.width - 1) / 2.0;
+	auto y0 = (entry.window.height - 1) / 2.0;
+	for (int v = 0; v < crop.height; ++v) {
+		auto row = map.ptr<cv::Vec2f>(v);
+		for (int u = 0; u < crop.width; ++u) {
+			row[u][0] = x0 + c * (u - u0) - s * (v - v0);
+			row[u][1] = y0 + s * (u - u0) + c * (v - v0);
+		}
+	}
+	//Fixed-point tables select the vectorized remap
+	cv::convertMaps(map, cv::noArray(), entry.map1, entry.map2, CV_16SC2);
+	entry.index = index;
+	entry.used = ++uses;
+	return slot;
+}
+
+} /* namespace wanhive */
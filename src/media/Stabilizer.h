@@ -0,0 +1,120 @@
+/*
+ * Stabilizer.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEDIA_STABILIZER_H_
+#define MEDIA_STABILIZER_H_
+#include <opencv2/opencv.hpp>
+
+namespace wanhive {
+/**
+ * Electronic image stabilization driven by a gyroscope
+ * The angular rates are integrated into the camera's orientation, and every
+ * frame is cropped (and warped) to follow a low-pass filtered path of the
+ * orientation instead of the measured one. The yaw and the pitch shift the
+ * crop window (zero-copy), the roll is corrected by a fixed-point remap whose
+ * maps are precomputed for the quantized angles and cached.
+ * The gyroscope's axes are the camera's: X to the right, Y down, and Z along
+ * the optical axis.
+ */
+class Stabilizer {
+public:
+	struct Settings {
+		unsigned int crop; //Percentage of the frame's width and height kept
+		unsigned int fov; //Horizontal field of view (degrees)
+		unsigned int smoothing; //Time constant of the path (milliseconds)
+	};
+public:
+	Stabilizer(const Settings &settings) noexcept;
+	~Stabilizer();
+	/*
+	 * Integrates the angular <rates> (radians/second) measured at the
+	 * <timestamp> (seconds) into the orientation. The timestamps must be
+	 * increasing.
+	 */
+	void rotate(double timestamp, const double rates[3]) noexcept;
+	/*
+	 * Stabilizes the <frame> captured at the <timestamp> (same clock as the
+	 * angular rates). Returns the cropped frame: either a region of the
+	 * <frame> or a warped copy owned by this object, valid until the next
+	 * call.
+	 */
+	const cv::Mat& apply(const cv::Mat &frame, double timestamp);
+	//Forgets the orientation and the path
+	void reset() noexcept;
+private:
+	//Orientation at the <timestamp>, interpolated from the recent history
+	void locate(double timestamp, double angles[3]) const noexcept;
+	//Crop geometry of a <width>x<height> frame, invalidates the cached maps
+	void resize(int width, int height) noexcept;
+	/*
+	 * Returns the cache slot holding the remap tables of the <index>th roll
+	 * step, builds the tables if required.
+	 */
+	unsigned int lookup(int index);
+public:
+	//Orientation history (gyroscope samples)
+	static constexpr unsigned int HISTORY = 1024;
+	//Quantization of the roll correction (degrees)
+	static constexpr double ROLL_STEP = 0.2;
+	//Number of cached remap tables
+	static constexpr unsigned int CACHE_SIZE = 8;
+private:
+	Settings settings;
+	//Integrated orientation (radians)
+	struct {
+		double timestamp;
+		double angles[3];
+	} history[HISTORY];
+	unsigned int head; //Next entry of the history
+	unsigned int size; //Entries in the history
+
+	//Smoothed path
+	struct {
+		double angles[3];
+		double timestamp; //Of the last frame (0: none)
+	} path;
+
+	//Geometry
+	struct {
+		cv::Size frame;
+		cv::Size crop;
+		double focal; //Focal length (pixels)
+		double roll; //Maximum roll correction (radians)
+	} geometry;
+
+	//Remap tables of the recently used roll steps
+	struct {
+		int index;
+		cv::Size window; //Source region read by the tables
+		cv::Mat map1; //Integer coordinates (CV_16SC2)
+		cv::Mat map2; //Interpolation weights (CV_16UC1)
+		unsigned long long used; //Last use (0: empty)
+	} cache[CACHE_SIZE];
+	unsigned long long uses;
+
+	cv::Mat image; //Warped frame
+	cv::Mat roi; //Cropped frame
+};
+
+} /* namespace wanhive */
+
+#endif /* MEDIA_STABILIZER_H_ */
@@ -0,0 +1,98 @@
+/*
+ * DeltaCodec.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef UTIL_DELTACODEC_H_
+#define UTIL_DELTACODEC_H_
+#include <cstdint>
+
+namespace wanhive {
+/**
+ * Delta encoding of the multi-channel 16-bit sample streams
+ * Every channel is encoded as the difference from its previous sample (the
+ * first sample from zero), zigzag mapped and written as a base-128 varint:
+ * slowly changing signals take about one byte per channel.
+ */
+class DeltaCodec {
+public:
+	//Maximum encoded size of a value
+	static constexpr unsigned int MAX_BYTES = 3;
+
+	/*
+	 * Encodes <count> samples of <channels> values each (interleaved) into
+	 * the <buffer> of <size> bytes. Returns the number of bytes written, 0 if
+	 * the <buffer> is too small.
+	 */
+	static unsigned int encode(const int16_t *values, unsigned int count,
+			unsigned int channels, unsigned char *buffer,
+			unsigned int size) noexcept {
+		unsigned int bytes = 0;
+		for (unsigned int i = 0; i < count * channels; ++i) {
+			int delta = values[i] - ((i >= channels) ? values[i - channels] : 0);
+			auto zigzag = (uint32_t) ((delta << 1) ^ (delta >> 31));
+			do {
+				if (bytes == size) {
+					return 0;
+				}
+
+				auto byte = (unsigned char) (zigzag & 0x7F);
+				zigzag >>= 7;
+				buffer[bytes++] = zigzag ? (byte | 0x80) : byte;
+			} while (zigzag);
+		}
+		return bytes;
+	}
+
+	/*
+	 * Decodes at most <count> samples of <channels> values each from the
+	 * <buffer> of <size> bytes. Returns the number of complete samples.
+	 */
+	static unsigned int decode(const unsigned char *buffer, unsigned int size,
+			unsigned int channels, int16_t *values,
+			unsigned int count) noexcept {
+		unsigned int bytes = 0;
+		for (unsigned int i = 0; i < count * channels; ++i) {
+			uint32_t zigzag = 0;
+			unsigned int shift = 0;
+			while (true) {
+				if (bytes == size || shift > 14) {
+					return i / channels;
+				}
+
+				auto byte = buffer[bytes++];
+				zigzag |= (uint32_t) (byte & 0x7F) << shift;
+				shift += 7;
+				if (!(byte & 0x80)) {
+					break;
+				}
+			}
+
+			int delta = (int) (zigzag >> 1) ^ -(int) (zigzag & 1);
+			values[i] = (int16_t) (delta
+					+ ((i >= channels) ? values[i - channels] : 0));
+		}
+		return count;
+	}
+};
+
+} /* namespace wanhive */
+
+#endif /* UTIL_DELTACODEC_H_ */
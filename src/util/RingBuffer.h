@@ -0,0 +1,87 @@
+/*
+ * RingBuffer.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef UTIL_RINGBUFFER_H_
+#define UTIL_RINGBUFFER_H_
+#include <atomic>
+#include <cstddef>
+
+namespace wanhive {
+/**
+ * Bounded lock-free single producer, single consumer queue
+ * The <CAPACITY> must be a power of two.
+ */
+template<typename T, unsigned int CAPACITY> class RingBuffer {
+	static_assert(CAPACITY && !(CAPACITY & (CAPACITY - 1)),
+			"Capacity must be a power of two");
+public:
+	RingBuffer() noexcept = default;
+	~RingBuffer() = default;
+	RingBuffer(const RingBuffer&) = delete;
+	RingBuffer& operator=(const RingBuffer&) = delete;
+
+	/*
+	 * Appends the <value> (producer only). Returns false if the queue is full.
+	 */
+	bool push(const T &value) noexcept {
+		auto tail = this->tail.load(std::memory_order_relaxed);
+		if (tail - head.load(std::memory_order_acquire) == CAPACITY) {
+			return false;
+		}
+
+		items[tail & (CAPACITY - 1)] = value;
+		this->tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/*
+	 * Removes the oldest value into <value> (consumer only). Returns false if
+	 * the queue is empty.
+	 */
+	bool pop(T &value) noexcept {
+		auto head = this->head.load(std::memory_order_relaxed);
+		if (head == tail.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		value = items[head & (CAPACITY - 1)];
+		this->head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/*
+	 * Returns the number of queued values (approximate if called concurrently)
+	 */
+	size_t size() const noexcept {
+		return tail.load(std::memory_order_acquire)
+				- head.load(std::memory_order_acquire);
+	}
+private:
+	//Separate cache lines for the producer and the consumer
+	alignas(64) std::atomic<size_t> head { 0 };
+	alignas(64) std::atomic<size_t> tail { 0 };
+	alignas(64) T items[CAPACITY];
+};
+
+} /* namespace wanhive */
+
+#endif /* UTIL_RINGBUFFER_H_ */
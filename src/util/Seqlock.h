@@ -0,0 +1,107 @@
+/*
+ * Seqlock.h
+ *
+ * Copyright (C) 2026 Wanhive Systems Private Limited (info@wanhive.com)
+ *
+ * SPDX License Identifier: GPL-3.0-or-later
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef UTIL_SEQLOCK_H_
+#define UTIL_SEQLOCK_H_
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace wanhive {
+/**
+ * Sequence lock for publishing a small trivially copyable value from a single
+ * writer to any number of readers. Readers never block the writer and never
+ * make a system call: they retry if the value changed while being copied.
+ * The value is stored as atomic words, hence the copies are race free.
+ */
+template<typename T> class Seqlock {
+	static_assert(std::is_trivially_copyable<T>::value,
+			"Seqlock requires a trivially copyable type");
+public:
+	Seqlock() noexcept {
+		for (auto &word : words) {
+			word.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	~Seqlock() = default;
+	Seqlock(const Seqlock&) = delete;
+	Seqlock& operator=(const Seqlock&) = delete;
+
+	/*
+	 * Publishes the <value> (single writer only)
+	 */
+	void store(const T &value) noexcept {
+		unsigned long long buffer[WORDS] = { };
+		memcpy(buffer, &value, sizeof(T));
+
+		auto seq = sequence.load(std::memory_order_relaxed);
+		sequence.store(seq + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		for (unsigned int i = 0; i < WORDS; ++i) {
+			words[i].store(buffer[i], std::memory_order_relaxed);
+		}
+		sequence.store(seq + 2, std::memory_order_release);
+	}
+
+	/*
+	 * Copies the latest value into <value>. Returns the version of the value,
+	 * incremented on every store (0: never stored, <value> is zero-filled).
+	 */
+	unsigned long long load(T &value) const noexcept {
+		unsigned long long buffer[WORDS];
+		unsigned long long seq;
+		while (true) {
+			seq = sequence.load(std::memory_order_acquire);
+			if (seq & 1) {
+				continue; //Write in progress
+			}
+
+			for (unsigned int i = 0; i < WORDS; ++i) {
+				buffer[i] = words[i].load(std::memory_order_relaxed);
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (sequence.load(std::memory_order_relaxed) == seq) {
+				break;
+			}
+		}
+
+		memcpy(&value, buffer, sizeof(T));
+		return seq / 2;
+	}
+
+	/*
+	 * Returns the version of the latest value (see load())
+	 */
+	unsigned long long version() const noexcept {
+		return sequence.load(std::memory_order_acquire) / 2;
+	}
+private:
+	static constexpr unsigned int WORDS = (sizeof(T)
+			+ sizeof(unsigned long long) - 1) / sizeof(unsigned long long);
+	std::atomic<unsigned long long> sequence { 0 };
+	std::atomic<unsigned long long> words[WORDS];
+};
+
+} /* namespace wanhive */
+
+#endif /* UTIL_SEQLOCK_H_ */
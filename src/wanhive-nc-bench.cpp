@@ -0,0 +1,219 @@
+//============================================================================
+// Name        : wanhive-nc-bench.cpp
+// Author      : Wanhive Systems Private Limited (info@wanhive.com)
+// Version     :
+// Copyright   : Copyright 2026 Wanhive Systems Private Limited
+// License     : GPL-3.0-or-later
+// Description : I2C benchmark: SMBus word accesses vs combined transfers
+//============================================================================
+
+#include "device/PCA9685.h"
+#include "interface/I2C.h"
+#include "interface/I2CAdapter.h"
+#include "interface/I2CSimulator.h"
+#include <wanhive/wanhive-base.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+namespace {
+
+using namespace wanhive;
+
+constexpr unsigned int DEVICE = 0x40; //Address of the gimbal's controller
+constexpr unsigned int ITERATIONS = 1000; //Default iteration count
+constexpr unsigned int PINS[3] = { 0, 2, 4 }; //Default pan, roll, tilt
+
+constexpr unsigned char MODE1_REG = 0x0;
+constexpr unsigned char MODE2_REG = 0x01;
+constexpr unsigned char LED0_ON_L = 0x06;
+constexpr unsigned char ALL_LED_ON_L = 0xFA;
+constexpr unsigned char PRESCALE_REG = 0xFE;
+constexpr unsigned int PIN_COUNT = 16;
+
+/**
+ * Counts the system calls and the messages (start conditions) of the
+ * transfers carried out by the <backend>.
+ */
+class Counter final: public I2CBus {
+public:
+	Counter(I2CBus *backend) noexcept :
+			backend(backend), transfers(0), messages(0) {
+	}
+
+	int access(unsigned int address, char readWrite, unsigned char command,
+			int size, union i2c_smbus_data *data) noexcept override {
+		++transfers;
+		//Register reads and process calls are write-read pairs
+		if (size == I2C_SMBUS_QUICK || size == I2C_SMBUS_BYTE
+				|| (readWrite == I2C_SMBUS_WRITE && size != I2C_SMBUS_PROC_CALL
+						&& size != I2C_SMBUS_BLOCK_PROC_CALL)) {
+			messages += 1;
+		} else {
+			messages += 2;
+		}
+		return backend->access(address, readWrite, command, size, data);
+	}
+
+	int transfer(struct i2c_msg *list, unsigned int count) noexcept
+			override {
+		++transfers;
+		messages += count;
+		return backend->transfer(list, count);
+	}
+
+	void reset() noexcept {
+		transfers = 0;
+		messages = 0;
+	}
+public:
+	I2CBus *backend;
+	unsigned long long transfers;
+	unsigned long long messages;
+};
+
+//The PWM value of a <pin>, changes on every <iteration>
+unsigned int value(unsigned int pin, unsigned int iteration) noexcept {
+	return 1000 + ((iteration & 1) * 500) + pin;
+}
+
+//Sets the PWM values of the <pins> like the SMBus driver (on and off words)
+void writePins(I2C &device, const unsigned int *pins, unsigned int count,
+		unsigned int iteration) {
+	for (unsigned int i = 0; i < count; ++i) {
+		unsigned short pwm = value(pins[i], iteration);
+		unsigned char reg = LED0_ON_L + (pins[i] * 4);
+		device.write(reg, (unsigned short) 0);
+		device.write(reg + 2, pwm);
+	}
+}
+
+//Same as above through the driver (a single combined transfer)
+void writePins(PCA9685 &device, const unsigned int *pins, unsigned int count,
+		unsigned int iteration) {
+	unsigned int values[PIN_COUNT];
+	for (unsigned int i = 0; i < count; ++i) {
+		values[i] = value(pins[i], iteration);
+	}
+	device.pwmWrite(pins, values, count);
+}
+
+//Reads the registers loaded by PCA9685::resync like the SMBus driver
+void readRegisters(I2C &device) {
+	unsigned char mode;
+	unsigned short ticks[(PIN_COUNT + 1) * 2];
+	device.read(MODE1_REG, mode);
+	device.read(MODE2_REG, mode);
+	for (unsigned int i = 0; i < PIN_COUNT * 2; ++i) {
+		device.read(LED0_ON_L + (i * 2), ticks[i]);
+	}
+	device.read(ALL_LED_ON_L, ticks[PIN_COUNT * 2]);
+	device.read(ALL_LED_ON_L + 2, ticks[PIN_COUNT * 2 + 1]);
+	device.read(PRESCALE_REG, mode);
+}
+
+/**
+ * Runs the <operation> <iterations> times, prints the per-operation costs
+ */
+template<typename F>
+void measure(const char *name, const char *path, unsigned int iterations,
+		Counter &counter, I2CSimulator *simulator, F operation) {
+	I2CSimulator::Statistics stats { };
+	counter.reset();
+	if (simulator) {
+		simulator->getStatistics(stats, true);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < iterations; ++i) {
+		operation(i);
+	}
+	auto elapsed = std::chrono::duration<double, std::micro>(
+			std::chrono::steady_clock::now() - start).count();
+
+	double n = iterations;
+	printf("%-10s %-9s %12.1f %12.1f", name, path, counter.transfers / n,
+			counter.messages / n);
+	if (simulator) {
+		simulator->getStatistics(stats);
+		printf(" %12.1f", stats.time / n);
+	} else {
+		printf(" %12s", "-");
+	}
+	printf(" %12.2f\n", elapsed / n);
+}
+
+void run(unsigned int iterations, I2CBus *backend, I2CSimulator *simulator) {
+	Counter counter(backend);
+	I2C smbus(&counter, DEVICE);
+	PCA9685 combined(&counter, DEVICE);
+
+	unsigned int all[PIN_COUNT];
+	for (unsigned int i = 0; i < PIN_COUNT; ++i) {
+		all[i] = i;
+	}
+
+	printf("%-10s %-9s %12s %12s %12s %12s\n", "operation", "path",
+			"transfers/op", "messages/op", "bus us/op", "wall us/op");
+	measure("gimbal", "smbus", iterations, counter, simulator,
+			[&](unsigned int i) {
+				writePins(smbus, PINS, 3, i);
+			});
+	measure("gimbal", "combined", iterations, counter, simulator,
+			[&](unsigned int i) {
+				writePins(combined, PINS, 3, i);
+			});
+	measure("channels", "smbus", iterations, counter, simulator,
+			[&](unsigned int i) {
+				writePins(smbus, all, PIN_COUNT, i);
+			});
+	measure("channels", "combined", iterations, counter, simulator,
+			[&](unsigned int i) {
+				writePins(combined, all, PIN_COUNT, i);
+			});
+	measure("resync", "smbus", iterations, counter, simulator,
+			[&](unsigned int) {
+				readRegisters(smbus);
+			});
+	measure("resync", "combined", iterations, counter, simulator,
+			[&](unsigned int) {
+				combined.resync();
+			});
+}
+
+} /* namespace */
+
+/*
+ * Usage: wanhive-nc-bench [iterations] [adapter]
+ * Runs against a simulated PCA9685 unless an adapter number is given (the
+ * controller at 0x40 on that adapter drives the servos while benchmarking).
+ */
+int main(int argc, char *argv[]) {
+	unsigned int iterations = ITERATIONS;
+	if (argc > 1 && !(iterations = strtoul(argv[1], nullptr, 10))) {
+		fprintf(stderr, "Usage: %s [iterations] [adapter]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	try {
+		std::unique_ptr<I2CBus> backend;
+		I2CSimulator *simulator = nullptr;
+		if (argc > 2) {
+			auto adapter = strtoul(argv[2], nullptr, 10);
+			backend.reset(new I2CAdapter(adapter));
+			printf("I2C-%lu, device 0x%x, %u iterations\n", adapter, DEVICE,
+					iterations);
+		} else {
+			simulator = new I2CSimulator();
+			backend.reset(simulator);
+			simulator->attach(DEVICE, I2CSimulator::PCA9685);
+			printf("Simulated PCA9685 (100 kHz), %u iterations\n", iterations);
+		}
+		run(iterations, backend.get(), simulator);
+		return EXIT_SUCCESS;
+	} catch (BaseException &e) {
+		fprintf(stderr, "%s\n", e.what());
+		return EXIT_FAILURE;
+	}
+}